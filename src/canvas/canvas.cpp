@@ -24,6 +24,7 @@
 
 #include "canvas.h"
 #include "canvas/internal/canvas_types_int.h"
+#include "canvas/internal/canvas_kernels.h"
 #include <string.h>
 
 /////////////////////////////////////////////////////////////////////////////////
@@ -142,6 +143,34 @@ template <uint8_t BPP> void NanoCanvasOps<BPP>::drawCircle(lcdint_t xc, lcdint_t
     }
 }
 
+template <uint8_t BPP> void NanoCanvasOps<BPP>::fillCircle(lcdint_t xc, lcdint_t yc, lcdint_t r)
+{
+    nano_fillCircle(*this, xc, yc, r);
+}
+
+template <uint8_t BPP>
+void NanoCanvasOps<BPP>::fillRoundRect(lcdint_t x1, lcdint_t y1, lcdint_t x2, lcdint_t y2, lcdint_t r)
+{
+    nano_fillRoundRect(*this, x1, y1, x2, y2, r);
+}
+
+template <uint8_t BPP>
+void NanoCanvasOps<BPP>::fillTriangle(lcdint_t x1, lcdint_t y1, lcdint_t x2, lcdint_t y2, lcdint_t x3, lcdint_t y3)
+{
+    nano_fillTriangle(*this, x1, y1, x2, y2, x3, y3);
+}
+
+template <uint8_t BPP> void NanoCanvasOps<BPP>::fillPolygon(const NanoPoint *points, uint8_t count)
+{
+    nano_fillPolygon(*this, points, count);
+}
+
+template <uint8_t BPP>
+void NanoCanvasOps<BPP>::drawThickLine(lcdint_t x1, lcdint_t y1, lcdint_t x2, lcdint_t y2, lcduint_t width)
+{
+    nano_drawThickLine(*this, x1, y1, x2, y2, width);
+}
+
 template <uint8_t BPP> uint8_t NanoCanvasOps<BPP>::printChar(uint8_t c)
 {
     uint16_t unicode = m_font->unicode16FromUtf8(c);
@@ -235,6 +264,7 @@ template <> void NanoCanvasOps<1>::putPixel(lcdint_t x, lcdint_t y)
 {
     x -= offset.x;
     y -= offset.y;
+    markDirty(x, y, x, y);
     if ( (x < 0) || (y < 0) )
         return;
     if ( (x >= (lcdint_t)m_w) || (y >= (lcdint_t)m_h) )
@@ -256,6 +286,7 @@ template <> void NanoCanvasOps<1>::drawHLine(lcdint_t x1, lcdint_t y1, lcdint_t
     x1 -= offset.x;
     x2 -= offset.x;
     y1 -= offset.y;
+    markDirty(x1, y1, x2, y1);
     if ( (y1 >= (lcdint_t)m_h) || (y1 < 0) )
         return;
     if ( (x2 < 0) || (x1 >= (lcdint_t)m_w) )
@@ -287,6 +318,7 @@ template <> void NanoCanvasOps<1>::drawVLine(lcdint_t x1, lcdint_t y1, lcdint_t
     x1 -= offset.x;
     y1 -= offset.y;
     y2 -= offset.y;
+    markDirty(x1, y1, x1, y2);
     if ( (x1 >= (lcdint_t)m_w) || (x1 < 0) )
         return;
     if ( (y2 < 0) || (y1 >= (lcdint_t)m_h) )
@@ -338,6 +370,7 @@ template <> void NanoCanvasOps<1>::fillRect(lcdint_t x1, lcdint_t y1, lcdint_t x
     x2 -= offset.x;
     y1 -= offset.y;
     y2 -= offset.y;
+    markDirty(x1, y1, x2, y2);
     if ( (x2 < 0) || (x1 >= (lcdint_t)m_w) )
         return;
     if ( (y2 < 0) || (y1 >= (lcdint_t)m_h) )
@@ -380,6 +413,7 @@ template <> void NanoCanvasOps<1>::fillRect(lcdint_t x1, lcdint_t y1, lcdint_t x
 template <> void NanoCanvasOps<1>::clear()
 {
     memset(m_buf, 0, YADDR1(m_h));
+    markCleared();
 }
 
 // TODO: Not so fast implementation. needs to be optimized
@@ -387,6 +421,7 @@ template <> void NanoCanvasOps<1>::drawBitmap1(lcdint_t x, lcdint_t y, lcduint_t
 {
     x -= offset.x;
     y -= offset.y;
+    markDirty(x, y, x + (lcdint_t)w - 1, y + (lcdint_t)h - 1);
     lcduint_t origin_width = w;
     uint8_t offs = y & 0x07;
     uint8_t complexFlag = 0;
@@ -477,6 +512,7 @@ template <> void NanoCanvasOps<1>::begin(lcdint_t w, lcdint_t h, uint8_t *bytes)
     m_textMode = 0;
     m_buf = bytes;
     clear();
+    markDirty(0, 0, m_w - 1, m_h - 1);
 }
 
 template <> void NanoCanvasOps<1>::rotateCW(NanoCanvasOps<1> &out)
@@ -499,6 +535,7 @@ template <> void NanoCanvasOps<1>::rotateCW(NanoCanvasOps<1> &out)
         out.m_w = m_h;
         out.m_h = m_w;
     }
+    out.markDirty(0, 0, out.m_w - 1, out.m_h - 1);
 }
 
 /////////////////////////////////////////////////////////////////////////////////
@@ -516,6 +553,7 @@ template <> void NanoCanvasOps<4>::putPixel(lcdint_t x, lcdint_t y)
 {
     x -= offset.x;
     y -= offset.y;
+    markDirty(x, y, x, y);
     if ( (x >= 0) && (y >= 0) && (x < (lcdint_t)m_w) && (y < (lcdint_t)m_h) )
     {
         m_buf[YADDR4(y) + x / 2] &= ~(0x0F << BITS_SHIFT4(x));
@@ -528,6 +566,7 @@ template <> void NanoCanvasOps<4>::drawVLine(lcdint_t x1, lcdint_t y1, lcdint_t
     x1 -= offset.x;
     y1 -= offset.y;
     y2 -= offset.y;
+    markDirty(x1, y1, x1, y2);
     if ( y1 > y2 )
     {
         canvas_swap_data(y1, y2, lcdint_t);
@@ -552,6 +591,7 @@ template <> void NanoCanvasOps<4>::drawHLine(lcdint_t x1, lcdint_t y1, lcdint_t
     x1 -= offset.x;
     y1 -= offset.y;
     x2 -= offset.x;
+    markDirty(x1, y1, x2, y1);
     if ( x1 > x2 )
     {
         canvas_swap_data(x1, x2, lcdint_t);
@@ -588,6 +628,7 @@ template <> void NanoCanvasOps<4>::fillRect(lcdint_t x1, lcdint_t y1, lcdint_t x
     y1 -= offset.y;
     x2 -= offset.x;
     y2 -= offset.y;
+    markDirty(x1, y1, x2, y2);
     if ( (x2 < 0) || (x1 >= (lcdint_t)m_w) )
         return;
     if ( (y2 < 0) || (y1 >= (lcdint_t)m_h) )
@@ -622,6 +663,7 @@ void NanoCanvasOps<4>::drawBitmap1(lcdint_t xpos, lcdint_t ypos, lcduint_t w, lc
     /* calculate char rectangle */
     lcdint_t x1 = xpos - offset.x;
     lcdint_t y1 = ypos - offset.y;
+    markDirty(x1, y1, x1 + (lcdint_t)w - 1, y1 + (lcdint_t)h - 1);
     lcdint_t x2 = x1 + xb2;
     lcdint_t y2 = y1 + yb2;
     /* clip bitmap */
@@ -682,6 +724,7 @@ void NanoCanvasOps<4>::drawBitmap8(lcdint_t xpos, lcdint_t ypos, lcduint_t w, lc
     /* calculate char rectangle */
     lcdint_t x1 = xpos - offset.x;
     lcdint_t y1 = ypos - offset.y;
+    markDirty(x1, y1, x1 + (lcdint_t)w - 1, y1 + (lcdint_t)h - 1);
     lcdint_t x2 = x1 + xb2;
     lcdint_t y2 = y1 + yb2;
     /* clip bitmap */
@@ -730,6 +773,7 @@ void NanoCanvasOps<4>::drawBitmap8(lcdint_t xpos, lcdint_t ypos, lcduint_t w, lc
 template <> void NanoCanvasOps<4>::clear()
 {
     memset(m_buf, 0, YADDR4(m_h));
+    markCleared();
 }
 
 /* This method must be implemented always after clear() */
@@ -746,6 +790,7 @@ template <> void NanoCanvasOps<4>::begin(lcdint_t w, lcdint_t h, uint8_t *bytes)
     m_textMode = 0;
     m_buf = bytes;
     clear();
+    markDirty(0, 0, m_w - 1, m_h - 1);
 }
 
 template <> void NanoCanvasOps<4>::rotateCW(NanoCanvasOps<4> &out)
@@ -767,6 +812,7 @@ template <> void NanoCanvasOps<8>::putPixel(lcdint_t x, lcdint_t y)
 {
     x -= offset.x;
     y -= offset.y;
+    markDirty(x, y, x, y);
     if ( (x >= 0) && (y >= 0) && (x < (lcdint_t)m_w) && (y < (lcdint_t)m_h) )
     {
         m_buf[YADDR8(y) + x] = m_color;
@@ -778,6 +824,7 @@ template <> void NanoCanvasOps<8>::drawVLine(lcdint_t x1, lcdint_t y1, lcdint_t
     x1 -= offset.x;
     y1 -= offset.y;
     y2 -= offset.y;
+    markDirty(x1, y1, x1, y2);
     if ( y1 > y2 )
     {
         canvas_swap_data(y1, y2, lcdint_t);
@@ -801,6 +848,7 @@ template <> void NanoCanvasOps<8>::drawHLine(lcdint_t x1, lcdint_t y1, lcdint_t
     x1 -= offset.x;
     y1 -= offset.y;
     x2 -= offset.x;
+    markDirty(x1, y1, x2, y1);
     if ( x1 > x2 )
     {
         canvas_swap_data(x1, x2, lcdint_t);
@@ -833,6 +881,7 @@ template <> void NanoCanvasOps<8>::fillRect(lcdint_t x1, lcdint_t y1, lcdint_t x
     y1 -= offset.y;
     x2 -= offset.x;
     y2 -= offset.y;
+    markDirty(x1, y1, x2, y2);
     if ( (x2 < 0) || (x1 >= (lcdint_t)m_w) )
         return;
     if ( (y2 < 0) || (y1 >= (lcdint_t)m_h) )
@@ -853,6 +902,27 @@ template <> void NanoCanvasOps<8>::fillRect(lcdint_t x1, lcdint_t y1, lcdint_t x
     }
 }
 
+/* Draws page of 1-bit bitmap: 8 column bytes are read at once and expanded row by row */
+static void drawPage1(uint8_t *dst, uint16_t stride, const uint8_t *bitmap, lcduint_t count, uint8_t offs, uint8_t rows,
+                      const uint8_t *lut, uint8_t bytesPerPixel, bool transparent)
+{
+    for ( lcduint_t x = 0; x < count; x += 8 )
+    {
+        uint8_t n = count - x < 8 ? count - x : 8;
+        uint8_t data[8] = {0};
+        for ( uint8_t i = 0; i < n; i++ )
+        {
+            data[i] = pgm_read_byte(bitmap + x + i);
+        }
+        uint8_t *p = dst + x * bytesPerPixel;
+        for ( uint8_t row = 0; row < rows; row++ )
+        {
+            canvas_expand1(p, canvas_gather1(data, row + offs), n, lut, bytesPerPixel, transparent);
+            p += stride;
+        }
+    }
+}
+
 template <>
 void NanoCanvasOps<8>::drawBitmap1(lcdint_t xpos, lcdint_t ypos, lcduint_t w, lcduint_t h, const uint8_t *bitmap)
 {
@@ -860,6 +930,7 @@ void NanoCanvasOps<8>::drawBitmap1(lcdint_t xpos, lcdint_t ypos, lcduint_t w, lc
     /* calculate char rectangle */
     lcdint_t x1 = xpos - offset.x;
     lcdint_t y1 = ypos - offset.y;
+    markDirty(x1, y1, x1 + (lcdint_t)w - 1, y1 + (lcdint_t)h - 1);
     lcdint_t x2 = x1 + (lcdint_t)w - 1;
     lcdint_t y2 = y1 + (lcdint_t)h - 1;
     /* clip bitmap */
@@ -887,25 +958,16 @@ void NanoCanvasOps<8>::drawBitmap1(lcdint_t xpos, lcdint_t ypos, lcduint_t w, lc
     {
         x2 = (lcdint_t)m_w - 1;
     }
+    uint8_t lut[CANVAS_LUT1_SIZE(1)];
+    canvas_lut1(lut, m_color, 0x00, 1);
     uint8_t offs2 = 8 - offs;
     lcdint_t y = y1;
     while ( y <= y2 )
     {
-        for ( lcdint_t x = x1; x <= x2; x++ )
-        {
-            uint8_t data = pgm_read_byte(bitmap);
-            uint16_t addr = YADDR8(y) + x;
-            for ( uint8_t n = 0; n < __min(y2 - y + 1, 8); n++ )
-            {
-                if ( data & (1 << (n + offs)) )
-                    m_buf[addr] = m_color;
-                else if ( !(m_textMode & CANVAS_MODE_TRANSPARENT) )
-                    m_buf[addr] = 0x00;
-                addr += (lcduint_t)m_w;
-            }
-            bitmap++;
-        }
-        bitmap += (w - (x2 - x1 + 1));
+        uint8_t rows = __min(y2 - y + 1, offs2);
+        drawPage1(m_buf + YADDR8(y) + x1, m_w, bitmap, x2 - x1 + 1, offs, rows, lut, 1,
+                  m_textMode & CANVAS_MODE_TRANSPARENT);
+        bitmap += w;
         y = y + offs2;
         offs = 0;
         offs2 = 8;
@@ -918,6 +980,7 @@ void NanoCanvasOps<8>::drawBitmap8(lcdint_t xpos, lcdint_t ypos, lcduint_t w, lc
     /* calculate char rectangle */
     lcdint_t x1 = xpos - offset.x;
     lcdint_t y1 = ypos - offset.y;
+    markDirty(x1, y1, x1 + (lcdint_t)w - 1, y1 + (lcdint_t)h - 1);
     lcdint_t x2 = x1 + (lcdint_t)w - 1;
     lcdint_t y2 = y1 + (lcdint_t)h - 1;
     /* clip bitmap */
@@ -964,6 +1027,7 @@ void NanoCanvasOps<8>::drawBitmap8(lcdint_t xpos, lcdint_t ypos, lcduint_t w, lc
 template <> void NanoCanvasOps<8u>::clear()
 {
     memset(m_buf, 0, YADDR8(m_h));
+    markCleared();
 }
 
 /* This method must be implemented always after clear() */
@@ -980,6 +1044,7 @@ template <> void NanoCanvasOps<8>::begin(lcdint_t w, lcdint_t h, uint8_t *bytes)
     m_textMode = 0;
     m_buf = bytes;
     clear();
+    markDirty(0, 0, m_w - 1, m_h - 1);
 }
 
 template <> void NanoCanvasOps<8>::rotateCW(NanoCanvasOps<8> &out)
@@ -1001,6 +1066,7 @@ template <> void NanoCanvasOps<16>::putPixel(lcdint_t x, lcdint_t y)
 {
     x -= offset.x;
     y -= offset.y;
+    markDirty(x, y, x, y);
     if ( (x >= 0) && (y >= 0) && (x < (lcdint_t)m_w) && (y < (lcdint_t)m_h) )
     {
         m_buf[YADDR16(y) + (x << 1)] = m_color >> 8;
@@ -1013,6 +1079,7 @@ template <> void NanoCanvasOps<16>::drawVLine(lcdint_t x1, lcdint_t y1, lcdint_t
     x1 -= offset.x;
     y1 -= offset.y;
     y2 -= offset.y;
+    markDirty(x1, y1, x1, y2);
     if ( y1 > y2 )
     {
         canvas_swap_data(y1, y2, lcdint_t);
@@ -1037,6 +1104,7 @@ template <> void NanoCanvasOps<16>::drawHLine(lcdint_t x1, lcdint_t y1, lcdint_t
     x1 -= offset.x;
     y1 -= offset.y;
     x2 -= offset.x;
+    markDirty(x1, y1, x2, y1);
     if ( x1 > x2 )
     {
         canvas_swap_data(x1, x2, lcdint_t);
@@ -1047,13 +1115,7 @@ template <> void NanoCanvasOps<16>::drawHLine(lcdint_t x1, lcdint_t y1, lcdint_t
         return;
     x1 = __max(x1, 0);
     x2 = __min(x2, (lcdint_t)m_w - 1);
-    uint8_t *buf = m_buf + YADDR16(y1) + (x1 << 1);
-    for ( lcdint_t x = 0; x <= x2 - x1; x++ )
-    {
-        buf[0] = m_color >> 8;
-        buf[1] = m_color & 0xFF;
-        buf += 2;
-    }
+    canvas_fill16(m_buf + YADDR16(y1) + (x1 << 1), m_color, x2 - x1 + 1);
 }
 
 template <> void NanoCanvasOps<16>::fillRect(lcdint_t x1, lcdint_t y1, lcdint_t x2, lcdint_t y2)
@@ -1070,6 +1132,7 @@ template <> void NanoCanvasOps<16>::fillRect(lcdint_t x1, lcdint_t y1, lcdint_t
     y1 -= offset.y;
     x2 -= offset.x;
     y2 -= offset.y;
+    markDirty(x1, y1, x2, y2);
     if ( (x2 < 0) || (x1 >= (lcdint_t)m_w) )
         return;
     if ( (y2 < 0) || (y1 >= (lcdint_t)m_h) )
@@ -1078,16 +1141,9 @@ template <> void NanoCanvasOps<16>::fillRect(lcdint_t x1, lcdint_t y1, lcdint_t
     x2 = __min(x2, (lcdint_t)m_w - 1);
     y1 = __max(y1, 0);
     y2 = __min(y2, (lcdint_t)m_h - 1);
-    uint8_t *buf = m_buf + YADDR16(y1) + (x1 << 1);
     for ( lcdint_t y = y1; y <= y2; y++ )
     {
-        for ( lcdint_t x = x1; x <= x2; x++ )
-        {
-            buf[0] = m_color >> 8;
-            buf[1] = m_color & 0xFF;
-            buf += 2;
-        }
-        buf += (((lcdint_t)(m_w) - (x2 - x1 + 1)) << 1);
+        canvas_fill16(m_buf + YADDR16(y) + (x1 << 1), m_color, x2 - x1 + 1);
     }
 }
 
@@ -1098,6 +1154,7 @@ void NanoCanvasOps<16>::drawBitmap1(lcdint_t xpos, lcdint_t ypos, lcduint_t w, l
     /* calculate char rectangle */
     lcdint_t x1 = xpos - offset.x;
     lcdint_t y1 = ypos - offset.y;
+    markDirty(x1, y1, x1 + (lcdint_t)w - 1, y1 + (lcdint_t)h - 1);
     lcdint_t x2 = x1 + (lcdint_t)w - 1;
     lcdint_t y2 = y1 + (lcdint_t)h - 1;
     /* clip bitmap */
@@ -1125,31 +1182,16 @@ void NanoCanvasOps<16>::drawBitmap1(lcdint_t xpos, lcdint_t ypos, lcduint_t w, l
     {
         x2 = (lcdint_t)m_w - 1;
     }
+    uint8_t lut[CANVAS_LUT1_SIZE(2)];
+    canvas_lut1(lut, m_color, 0x00, 2);
     uint8_t offs2 = 8 - offs;
     lcdint_t y = y1;
     while ( y <= y2 )
     {
-        for ( lcdint_t x = x1; x <= x2; x++ )
-        {
-            uint8_t data = pgm_read_byte(bitmap);
-            uint16_t addr = YADDR16(y) + (x << 1);
-            for ( uint8_t n = 0; n < __min(y2 - y + 1, 8); n++ )
-            {
-                if ( data & (1 << (n + offs)) )
-                {
-                    m_buf[addr] = m_color >> 8;
-                    m_buf[addr + 1] = m_color & 0xFF;
-                }
-                else if ( !(m_textMode & CANVAS_MODE_TRANSPARENT) )
-                {
-                    m_buf[addr] = 0x00;
-                    m_buf[addr + 1] = 0x00;
-                }
-                addr += ((lcduint_t)m_w << 1);
-            }
-            bitmap++;
-        }
-        bitmap += (w - (x2 - x1 + 1));
+        uint8_t rows = __min(y2 - y + 1, offs2);
+        drawPage1(m_buf + YADDR16(y) + (x1 << 1), (uint16_t)m_w << 1, bitmap, x2 - x1 + 1, offs, rows, lut, 2,
+                  m_textMode & CANVAS_MODE_TRANSPARENT);
+        bitmap += w;
         y = y + offs2;
         offs = 0;
         offs2 = 8;
@@ -1162,6 +1204,7 @@ void NanoCanvasOps<16>::drawBitmap8(lcdint_t xpos, lcdint_t ypos, lcduint_t w, l
     /* calculate char rectangle */
     lcdint_t x1 = xpos - offset.x;
     lcdint_t y1 = ypos - offset.y;
+    markDirty(x1, y1, x1 + (lcdint_t)w - 1, y1 + (lcdint_t)h - 1);
     lcdint_t x2 = x1 + (lcdint_t)w - 1;
     lcdint_t y2 = y1 + (lcdint_t)h - 1;
     /* clip bitmap */
@@ -1191,17 +1234,22 @@ void NanoCanvasOps<16>::drawBitmap8(lcdint_t xpos, lcdint_t ypos, lcduint_t w, l
     lcdint_t y = y1;
     while ( y <= y2 )
     {
+#if defined(CANVAS_SIMD)
+        canvas_rgb8to16(m_buf + YADDR16(y) + (x1 << 1), bitmap, x2 - x1 + 1, m_textMode & CANVAS_MODE_TRANSPARENT);
+        bitmap += x2 - x1 + 1;
+#else
         for ( lcdint_t x = x1; x <= x2; x++ )
         {
             uint8_t data = pgm_read_byte(bitmap);
             if ( (data) || (!(m_textMode & CANVAS_MODE_TRANSPARENT)) )
             {
-                uint16_t color = (((uint16_t)data & 0b11100000) << 8) | (((uint16_t)data & 0b00011100) << 6) |
-                                 (((uint16_t)data & 0b00000011) << 3);
-                m_buf[YADDR16(y) + (x << 1)] = color;
+                uint16_t color = RGB8_TO_RGB16(data);
+                m_buf[YADDR16(y) + (x << 1)] = color >> 8;
+                m_buf[YADDR16(y) + (x << 1) + 1] = color & 0xFF;
             }
             bitmap++;
         }
+#endif
         bitmap += (w - (x2 - x1 + 1));
         y++;
     }
@@ -1213,6 +1261,7 @@ void NanoCanvasOps<16>::drawBitmap16(lcdint_t xpos, lcdint_t ypos, lcduint_t w,
     /* calculate char rectangle */
     lcdint_t x1 = xpos - offset.x;
     lcdint_t y1 = ypos - offset.y;
+    markDirty(x1, y1, x1 + (lcdint_t)w - 1, y1 + (lcdint_t)h - 1);
     lcdint_t x2 = x1 + (lcdint_t)w - 1;
     lcdint_t y2 = y1 + (lcdint_t)h - 1;
     /* clip bitmap */
@@ -1242,6 +1291,10 @@ void NanoCanvasOps<16>::drawBitmap16(lcdint_t xpos, lcdint_t ypos, lcduint_t w,
     lcdint_t y = y1;
     while ( y <= y2 )
     {
+#if defined(CANVAS_SIMD)
+        canvas_copy16(m_buf + YADDR16(y) + (x1 << 1), bitmap, x2 - x1 + 1, m_textMode & CANVAS_MODE_TRANSPARENT);
+        bitmap += (x2 - x1 + 1) * 2;
+#else
         for ( lcdint_t x = x1; x <= x2; x++ )
         {
             uint8_t data1 = pgm_read_byte(bitmap);
@@ -1253,6 +1306,7 @@ void NanoCanvasOps<16>::drawBitmap16(lcdint_t xpos, lcdint_t ypos, lcduint_t w,
             }
             bitmap += 2;
         }
+#endif
         bitmap += (w - (x2 - x1 + 1)) * 2;
         y++;
     }
@@ -1261,6 +1315,7 @@ void NanoCanvasOps<16>::drawBitmap16(lcdint_t xpos, lcdint_t ypos, lcduint_t w,
 template <> void NanoCanvasOps<16>::clear()
 {
     memset(m_buf, 0, YADDR16(m_h));
+    markCleared();
 }
 
 template <> void NanoCanvasOps<16>::begin(lcdint_t w, lcdint_t h, uint8_t *bytes)
@@ -1275,6 +1330,7 @@ template <> void NanoCanvasOps<16>::begin(lcdint_t w, lcdint_t h, uint8_t *bytes
     m_textMode = 0;
     m_buf = bytes;
     clear();
+    markDirty(0, 0, m_w - 1, m_h - 1);
 }
 
 template <> void NanoCanvasOps<16>::rotateCW(NanoCanvasOps<16> &out)
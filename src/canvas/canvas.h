@@ -31,6 +31,7 @@
 #include "point.h"
 #include "rect.h"
 #include "font.h"
+#include "spans.h"
 #include "canvas_types.h"
 
 /**
@@ -98,6 +99,22 @@ public:
      */
     void begin(lcdint_t w, lcdint_t h, uint8_t *bytes);
 
+    /**
+     * Changes memory buffer and size of the canvas. Unlike begin(), keeps colors,
+     * font, mode and offset, and doesn't clear the buffer.
+     *
+     * @param w - width
+     * @param h - height
+     * @param bytes - pointer to memory buffer to use
+     */
+    void setBuffer(lcduint_t w, lcduint_t h, uint8_t *bytes)
+    {
+        m_w = w;
+        m_h = h;
+        m_buf = bytes;
+        markDirty(0, 0, m_w - 1, m_h - 1);
+    }
+
     /**
      * Sets offset
      * @param ox - X offset in pixels
@@ -227,6 +244,54 @@ public:
      */
     void drawCircle(lcdint_t x, lcdint_t y, lcdint_t r, uint8_t options = 0x0F) __attribute__((noinline));
 
+    /**
+     * Fills circle. Each row of the circle is drawn as single horizontal span.
+     * The filled area matches outline of drawCircle().
+     * @param x horizontal position of circle center in pixels
+     * @param y vertical position of circle center in pixels
+     * @param r circle radius in pixels
+     */
+    void fillCircle(lcdint_t x, lcdint_t y, lcdint_t r) __attribute__((noinline));
+
+    /**
+     * Fills rectangle with rounded corners.
+     * @param x1 - left X
+     * @param y1 - top Y
+     * @param x2 - right X
+     * @param y2 - bottom Y
+     * @param r - radius of corners in pixels
+     */
+    void fillRoundRect(lcdint_t x1, lcdint_t y1, lcdint_t x2, lcdint_t y2, lcdint_t r) __attribute__((noinline));
+
+    /**
+     * Fills triangle.
+     * @param x1 - position X of the first vertex
+     * @param y1 - position Y of the first vertex
+     * @param x2 - position X of the second vertex
+     * @param y2 - position Y of the second vertex
+     * @param x3 - position X of the third vertex
+     * @param y3 - position Y of the third vertex
+     */
+    void fillTriangle(lcdint_t x1, lcdint_t y1, lcdint_t x2, lcdint_t y2, lcdint_t x3, lcdint_t y3)
+        __attribute__((noinline));
+
+    /**
+     * Fills convex or concave polygon, using even-odd rule.
+     * @param points - polygon vertices
+     * @param count - number of vertices
+     */
+    void fillPolygon(const NanoPoint *points, uint8_t count) __attribute__((noinline));
+
+    /**
+     * Draws line of specified width.
+     * @param x1 - start position X
+     * @param y1 - start position Y
+     * @param x2 - end position X
+     * @param y2 - end position Y
+     * @param width - line width in pixels
+     */
+    void drawThickLine(lcdint_t x1, lcdint_t y1, lcdint_t x2, lcdint_t y2, lcduint_t width) __attribute__((noinline));
+
     /**
      * @brief Draws monochrome bitmap in color buffer using color, specified via setColor() method
      * Draws monochrome bitmap in color buffer using color, specified via setColor() method
@@ -445,6 +510,60 @@ public:
     /** Rotates the canvas clock-wise */
     void rotateCW(T &out);
 
+    /**
+     * Returns area of the canvas, changed since last resetDirty(), in pixels
+     * relative to the top-left corner of the canvas buffer (offset is not applied).
+     * The area is empty, if p1.x > p2.x. All drawing functions extend the area, and
+     * clear() adds area, drawn since previous clear().
+     */
+    const NanoRect &getDirtyRect() const
+    {
+        return m_dirty;
+    }
+
+    /**
+     * Marks the canvas as unchanged. NanoDisplayOps::drawCanvasDirty() calls it after
+     * sending the changed area to the display.
+     */
+    void resetDirty()
+    {
+        m_dirty = {{0, 0}, {-1, -1}};
+    }
+
+    /**
+     * Adds area to the changed area of the canvas. Call it after changing canvas data,
+     * returned by getData(), directly.
+     * @param x1 - left position relative to canvas buffer
+     * @param y1 - top position relative to canvas buffer
+     * @param x2 - right position relative to canvas buffer
+     * @param y2 - bottom position relative to canvas buffer
+     */
+    void markDirty(lcdint_t x1, lcdint_t y1, lcdint_t x2, lcdint_t y2)
+    {
+        if ( x2 < x1 )
+        {
+            lcdint_t t = x1;
+            x1 = x2;
+            x2 = t;
+        }
+        if ( y2 < y1 )
+        {
+            lcdint_t t = y1;
+            y1 = y2;
+            y2 = t;
+        }
+        x1 = x1 < 0 ? 0 : x1;
+        y1 = y1 < 0 ? 0 : y1;
+        x2 = x2 < (lcdint_t)m_w ? x2 : (lcdint_t)m_w - 1;
+        y2 = y2 < (lcdint_t)m_h ? y2 : (lcdint_t)m_h - 1;
+        if ( x1 > x2 || y1 > y2 )
+        {
+            return;
+        }
+        addRect(m_dirty, x1, y1, x2, y2);
+        addRect(m_drawn, x1, y1, x2, y2);
+    }
+
 protected:
     lcduint_t m_w;              ///< width of NanoCanvas area in pixels
     lcduint_t m_h;              ///< height of NanoCanvas area in pixels
@@ -456,6 +575,35 @@ protected:
     uint16_t m_color;           ///< current color
     uint16_t m_bgColor;         ///< current background color
     NanoFont *m_font = nullptr; ///< current set font to use with NanoCanvas
+    NanoRect m_dirty = {{0, 0}, {-1, -1}}; ///< area, changed since last resetDirty()
+    NanoRect m_drawn = {{0, 0}, {-1, -1}}; ///< area, drawn since last clear()
+
+    /**
+     * Adds area, drawn since previous clear(), to the changed area.
+     * Called by clear(), since the area is cleared now.
+     */
+    void markCleared()
+    {
+        if ( m_drawn.p1.x <= m_drawn.p2.x )
+        {
+            addRect(m_dirty, m_drawn.p1.x, m_drawn.p1.y, m_drawn.p2.x, m_drawn.p2.y);
+        }
+        m_drawn = {{0, 0}, {-1, -1}};
+    }
+
+private:
+    static void addRect(NanoRect &rect, lcdint_t x1, lcdint_t y1, lcdint_t x2, lcdint_t y2)
+    {
+        if ( rect.p1.x > rect.p2.x )
+        {
+            rect = {{x1, y1}, {x2, y2}};
+            return;
+        }
+        rect.p1.x = x1 < rect.p1.x ? x1 : rect.p1.x;
+        rect.p1.y = y1 < rect.p1.y ? y1 : rect.p1.y;
+        rect.p2.x = x2 > rect.p2.x ? x2 : rect.p2.x;
+        rect.p2.y = y2 > rect.p2.y ? y2 : rect.p2.y;
+    }
 };
 
 /**
@@ -123,6 +123,26 @@ typedef struct
 } SFontHeaderRecord;
 #pragma pack(pop)
 
+#ifndef NANO_FONT_INDEX_SIZE
+#if defined(__AVR__)
+/**
+ * Maximum number of unicode blocks, indexed by NanoFont for binary search.
+ * Fonts with more blocks are searched sequentially. 0 disables the index.
+ */
+#define NANO_FONT_INDEX_SIZE 0
+#else
+#define NANO_FONT_INDEX_SIZE 64
+#endif
+#endif
+
+/** Structure describes indexed unicode block of the font */
+typedef struct
+{
+    uint16_t start_code; ///< unicode start code
+    uint8_t count;       ///< count of unicode chars in block
+    const uint8_t *data; ///< block data, following unicode block record
+} SFontBlockIndexRecord;
+
 /** Structure is used for internal font presentation */
 typedef struct
 {
@@ -135,6 +155,10 @@ typedef struct
 #ifdef CONFIG_SSD1306_UNICODE_ENABLE
     const uint8_t *secondary_table; ///< font chars bits
 #endif
+#if NANO_FONT_INDEX_SIZE > 0
+    uint8_t index_size; ///< number of indexed blocks, 0xFF if tables must be searched sequentially
+    SFontBlockIndexRecord index[NANO_FONT_INDEX_SIZE]; ///< unicode blocks, sorted by start code
+#endif
 } SFixedFontInfo;
 
 /** Structure describes single char information */
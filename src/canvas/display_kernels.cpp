@@ -0,0 +1,50 @@
+/*
+    MIT License
+
+    Copyright (c) 2026, Alexey Dynda
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include "canvas/internal/display_kernels.h"
+#include "canvas/internal/canvas_kernels.h"
+
+static_assert(DISPLAY_LUT1_SIZE(2) == CANVAS_LUT1_SIZE(2), "display and canvas lookup tables must match");
+
+void display_lut1(uint8_t *lut, uint16_t fg, uint16_t bg, uint8_t bytesPerPixel)
+{
+    canvas_lut1(lut, fg, bg, bytesPerPixel);
+}
+
+void display_expand1(uint8_t *dst, const uint8_t *cols, uint8_t count, uint8_t bit, const uint8_t *lut,
+                     uint8_t bytesPerPixel)
+{
+    canvas_expand1(dst, canvas_gather1(cols, bit), count, lut, bytesPerPixel, false);
+}
+
+void display_row1(uint8_t *dst, const uint8_t *cols, uint16_t count, uint8_t bit, const uint8_t *lut,
+                  uint8_t bytesPerPixel)
+{
+    canvas_row1(dst, cols, count, bit, lut, bytesPerPixel);
+}
+
+void display_rgb8to16(uint8_t *dst, const uint8_t *src, uint32_t count)
+{
+    canvas_rgb8to16(dst, src, count, false);
+}
@@ -23,6 +23,7 @@
 */
 
 #include "font.h"
+#include "font_utf8.h"
 #include "canvas/internal/canvas_types_int.h"
 
 enum
@@ -45,69 +46,141 @@ static const uint8_t *ssd1306_readUnicodeRecord(SUnicodeBlockRecord *r, const ui
     return (r->count > 0) ? (&p[3]) : nullptr;
 }
 
-//////////////////////////////////////////////////////////////////////////////////////////////////
-/// OLD FORMAT: 1.7.6 and below
-/// OLD FORMAT is supported by old and latest versions of ssd1306 library
+/* Returns pointer to the next unicode record. data points to block data after unicode record */
+static const uint8_t *ssd1306_skipUnicodeBlock(const SFixedFontInfo &font, const SUnicodeBlockRecord &r,
+                                               const uint8_t *data, bool jumpTables)
+{
+    if ( !jumpTables )
+    {
+        return data + r.count * font.glyph_size;
+    }
+    // skip jump table
+    data += static_cast<uint16_t>(r.count) * 4;
+    // skip block bitmap data
+    uint16_t offset =
+        ((static_cast<uint16_t>(pgm_read_byte(&data[0])) << 8) | static_cast<uint16_t>(pgm_read_byte(&data[1]))) + 2;
+    return data + offset;
+}
 
-static const uint8_t *ssd1306_getCharGlyph(const SFixedFontInfo &font, char ch)
+static const uint8_t *ssd1306_scanUnicodeTable(const SFixedFontInfo &font, const uint8_t *data, uint16_t unicode,
+                                               bool jumpTables, SUnicodeBlockRecord *r)
 {
-    return &font.primary_table[(ch - font.h.ascii_offset) * font.glyph_size +
-                               (font.h.type == 0x01 ? sizeof(SUnicodeBlockRecord) : 0)];
+    while ( data )
+    {
+        const uint8_t *block = ssd1306_readUnicodeRecord(r, data);
+        if ( !block )
+        {
+            break;
+        }
+        if ( (unicode >= r->start_code) && (unicode < (r->start_code + r->count)) )
+        {
+            return block;
+        }
+        data = ssd1306_skipUnicodeBlock(font, *r, block, jumpTables);
+    }
+    return nullptr;
 }
 
-#ifdef CONFIG_SSD1306_UNICODE_ENABLE
-static const uint8_t *ssd1306_searchCharGlyph(const SFixedFontInfo &font, const uint8_t *unicode_table,
-                                              uint16_t unicode)
+#if NANO_FONT_INDEX_SIZE > 0
+#define NANO_FONT_INDEX_DISABLED 0xFF
+
+static void ssd1306_indexUnicodeTable(SFixedFontInfo &font, const uint8_t *data, bool jumpTables)
 {
     SUnicodeBlockRecord r;
-    const uint8_t *data = unicode_table;
-    // looking for required unicode table
-    while ( 1 )
+    while ( data && font.index_size != NANO_FONT_INDEX_DISABLED )
     {
-        ssd1306_readUnicodeRecord(&r, data);
-        if ( r.count == 0 )
+        const uint8_t *block = ssd1306_readUnicodeRecord(&r, data);
+        if ( !block )
         {
             break;
         }
-        data += sizeof(SUnicodeBlockRecord);
-        if ( (unicode >= r.start_code) && (unicode < (r.start_code + r.count)) )
+        if ( font.index_size >= NANO_FONT_INDEX_SIZE )
         {
+            font.index_size = NANO_FONT_INDEX_DISABLED;
             break;
         }
-        data += r.count * font.glyph_size;
+        // Keep records sorted by start code, so the lookup can use binary search
+        uint8_t i = font.index_size++;
+        while ( i > 0 && font.index[i - 1].start_code > r.start_code )
+        {
+            font.index[i] = font.index[i - 1];
+            i--;
+        }
+        font.index[i].start_code = r.start_code;
+        font.index[i].count = r.count;
+        font.index[i].data = block;
+        data = ssd1306_skipUnicodeBlock(font, r, block, jumpTables);
+    }
+}
+#endif
+
+/* Returns block data for the unicode char, searching primary table first and then secondary one */
+static const uint8_t *ssd1306_findUnicodeBlock(const SFixedFontInfo &font, const uint8_t *primary, uint16_t unicode,
+                                               bool jumpTables, SUnicodeBlockRecord *r)
+{
+#if NANO_FONT_INDEX_SIZE > 0
+    if ( font.index_size != NANO_FONT_INDEX_DISABLED )
+    {
+        uint8_t lo = 0;
+        uint8_t hi = font.index_size;
+        while ( lo < hi )
+        {
+            uint8_t mid = (lo + hi) >> 1;
+            const SFontBlockIndexRecord &rec = font.index[mid];
+            if ( unicode < rec.start_code )
+            {
+                hi = mid;
+            }
+            else if ( unicode >= rec.start_code + rec.count )
+            {
+                lo = mid + 1;
+            }
+            else
+            {
+                r->start_code = rec.start_code;
+                r->count = rec.count;
+                return rec.data;
+            }
+        }
+        return nullptr;
     }
-    if ( r.count == 0 )
+#endif
+    const uint8_t *data = ssd1306_scanUnicodeTable(font, primary, unicode, jumpTables, r);
+#ifdef CONFIG_SSD1306_UNICODE_ENABLE
+    if ( !data )
     {
-        // Sorry, no glyph found for the specified character
-        return NULL;
+        data = ssd1306_scanUnicodeTable(font, font.secondary_table, unicode, jumpTables, r);
     }
-    return &data[(unicode - r.start_code) * font.glyph_size];
-}
 #endif
+    return data;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+/// OLD FORMAT: 1.7.6 and below
+/// OLD FORMAT is supported by old and latest versions of ssd1306 library
+
+static const uint8_t *ssd1306_getCharGlyph(const SFixedFontInfo &font, char ch)
+{
+    return &font.primary_table[(ch - font.h.ascii_offset) * font.glyph_size +
+                               (font.h.type == 0x01 ? sizeof(SUnicodeBlockRecord) : 0)];
+}
 
 static const uint8_t *ssd1306_getU16CharGlyph(const SFixedFontInfo &font, uint16_t unicode)
 {
 #ifdef CONFIG_SSD1306_UNICODE_ENABLE
     if ( g_ssd1306_unicode2 )
     {
-        const uint8_t *glyph = NULL;
         if ( (unicode < 128) && (font.h.type == 0x00) && (font.primary_table != NULL) )
         {
             return ssd1306_getCharGlyph(font, unicode);
         }
-        if ( font.primary_table )
-        {
-            glyph = ssd1306_searchCharGlyph(font, font.primary_table, unicode);
-        }
-        if ( !glyph && font.secondary_table )
-        {
-            glyph = ssd1306_searchCharGlyph(font, font.secondary_table, unicode);
-        }
-        if ( !glyph )
+        SUnicodeBlockRecord r;
+        const uint8_t *data = ssd1306_findUnicodeBlock(font, font.primary_table, unicode, false, &r);
+        if ( !data )
         {
             return ssd1306_getCharGlyph(font, font.h.ascii_offset);
         }
-        return glyph;
+        return &data[(unicode - r.start_code) * font.glyph_size];
     }
     else
 #endif
@@ -141,6 +214,7 @@ void NanoFont::loadFixedFont(const uint8_t *progmemFont)
 #ifdef CONFIG_SSD1306_UNICODE_ENABLE
     m_fixedFont.secondary_table = NULL;
 #endif
+    buildIndex();
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////////
@@ -151,59 +225,26 @@ static void _ssd1306_newFormatGetBitmap(const SFixedFontInfo &font, uint16_t uni
 {
     if ( info )
     {
-#ifdef CONFIG_SSD1306_UNICODE_ENABLE
-        uint8_t table_index = 0;
-#endif
-        const uint8_t *data = font.primary_table;
-        while ( data )
-        {
-            SUnicodeBlockRecord r;
-            data = ssd1306_readUnicodeRecord(&r, data);
-            if ( !data )
-            {
-#ifdef CONFIG_SSD1306_UNICODE_ENABLE
-                if ( table_index == 0 )
-                {
-                    table_index++;
-                    data = font.secondary_table;
-                    continue;
-                }
-#endif
-                break;
-            }
-            /* Check that unicode in the section being processed */
-            if ( (unicode < r.start_code) || (unicode >= (r.start_code + r.count)) )
-            {
-                // skip jump table
-                data += static_cast<uint16_t>(r.count) * 4;
-                // skip block bitmap data
-                uint16_t offset = ((static_cast<uint16_t>(pgm_read_byte(&data[0])) << 8) |
-                                   static_cast<uint16_t>(pgm_read_byte(&data[1]))) +
-                                  2;
-                //                printf("JMP OFFSET: %d\n", offset);
-                data += offset;
-                //                printf("JMP DONE: %02X %02X %02X\n", data[0], data[1], data[2]);
-                continue;
-            }
-            /* At this point data points to jump table (offset|offset|bytes|width) */
-            unicode -= r.start_code;
-            data += unicode * 4;
-            uint16_t offset = (pgm_read_byte(&data[0]) << 8) | (pgm_read_byte(&data[1]));
-            uint8_t glyph_width = pgm_read_byte(&data[2]);
-            uint8_t glyph_height = pgm_read_byte(&data[3]);
-            info->width = glyph_width;
-            info->height = glyph_height;
-            info->spacing = glyph_width ? font.spacing : (font.h.width >> 1);
-            info->glyph = data + (r.count - unicode) * 4 + 2 + offset;
-            break;
-        }
-        if ( !info->glyph )
+        SUnicodeBlockRecord r;
+        const uint8_t *data = ssd1306_findUnicodeBlock(font, font.primary_table, unicode, true, &r);
+        if ( !data )
         {
             info->width = 0;
             info->height = 0;
             info->spacing = font.h.width >> 1;
             info->glyph = font.primary_table;
+            return;
         }
+        /* At this point data points to jump table (offset|offset|bytes|width) */
+        unicode -= r.start_code;
+        data += unicode * 4;
+        uint16_t offset = (pgm_read_byte(&data[0]) << 8) | (pgm_read_byte(&data[1]));
+        uint8_t glyph_width = pgm_read_byte(&data[2]);
+        uint8_t glyph_height = pgm_read_byte(&data[3]);
+        info->width = glyph_width;
+        info->height = glyph_height;
+        info->spacing = glyph_width ? font.spacing : (font.h.width >> 1);
+        info->glyph = data + (r.count - unicode) * 4 + 2 + offset;
     }
 }
 
@@ -220,6 +261,7 @@ void NanoFont::loadFreeFont(const uint8_t *progmemFont)
 #ifdef CONFIG_SSD1306_UNICODE_ENABLE
     m_fixedFont.secondary_table = NULL;
 #endif
+    buildIndex();
 }
 
 void NanoFont::loadSecondaryFont(const uint8_t *progmemUnicode)
@@ -231,6 +273,7 @@ void NanoFont::loadSecondaryFont(const uint8_t *progmemUnicode)
         m_fixedFont.secondary_table += sizeof(SFontHeaderRecord);
     }
 #endif
+    buildIndex();
 }
 
 void NanoFont::loadFixedFont_oldStyle(const uint8_t *progmemFont)
@@ -243,6 +286,7 @@ void NanoFont::loadFixedFont_oldStyle(const uint8_t *progmemFont)
     m_fixedFont.pages = (m_fixedFont.h.height + 7) >> 3;
     m_fixedFont.glyph_size = m_fixedFont.pages * m_fixedFont.h.width;
     m_fixedFont.spacing = 0;
+    buildIndex();
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////////
@@ -297,36 +341,152 @@ void NanoFont::loadSquixFont(const uint8_t *progmemFont)
 #ifdef CONFIG_SSD1306_UNICODE_ENABLE
     m_fixedFont.secondary_table = NULL;
 #endif
+    buildIndex();
+}
+
+void NanoFont::buildIndex()
+{
+#if NANO_FONT_INDEX_SIZE > 0
+    m_fixedFont.index_size = 0;
+    if ( m_getCharBitmap == _ssd1306_newFormatGetBitmap )
+    {
+        ssd1306_indexUnicodeTable(m_fixedFont, m_fixedFont.primary_table, true);
+#ifdef CONFIG_SSD1306_UNICODE_ENABLE
+        ssd1306_indexUnicodeTable(m_fixedFont, m_fixedFont.secondary_table, true);
+#endif
+    }
+    else if ( m_getCharBitmap == _ssd1306_oldFormatGetBitmap )
+    {
+        // Primary table of old fixed font has no unicode records
+        if ( m_fixedFont.h.type != SSD1306_OLD_FIXED_FORMAT )
+        {
+            ssd1306_indexUnicodeTable(m_fixedFont, m_fixedFont.primary_table, false);
+        }
+#ifdef CONFIG_SSD1306_UNICODE_ENABLE
+        ssd1306_indexUnicodeTable(m_fixedFont, m_fixedFont.secondary_table, false);
+#endif
+    }
+    // Overlapping blocks are resolved by sequential search, which gives priority to primary table
+    for ( uint8_t i = 1; i < m_fixedFont.index_size && m_fixedFont.index_size != NANO_FONT_INDEX_DISABLED; i++ )
+    {
+        if ( m_fixedFont.index[i - 1].start_code + m_fixedFont.index[i - 1].count > m_fixedFont.index[i].start_code )
+        {
+            m_fixedFont.index_size = NANO_FONT_INDEX_DISABLED;
+        }
+    }
+#endif
+    resetCache();
 }
 
 void NanoFont::getCharBitmap(uint16_t ch, SCharInfo *info)
 {
+#if NANO_FONT_CACHE_SIZE > 0
+    uint8_t slot = ch & (NANO_FONT_CACHE_SIZE - 1);
+#ifdef CONFIG_SSD1306_UNICODE_ENABLE
+    if ( !g_ssd1306_unicode2 )
+    {
+        // Single-byte mode: glyphs are addressed directly, no need to cache them
+        m_getCharBitmap(m_fixedFont, ch, info);
+        return;
+    }
+#endif
+    if ( info && ch != SSD1306_MORE_CHARS_REQUIRED )
+    {
+        if ( m_cacheCode[slot] != ch )
+        {
+            m_getCharBitmap(m_fixedFont, ch, &m_cacheInfo[slot]);
+            m_cacheCode[slot] = ch;
+        }
+        *info = m_cacheInfo[slot];
+        return;
+    }
+#endif
     m_getCharBitmap(m_fixedFont, ch, info);
 }
 
 lcduint_t NanoFont::getTextSize(const char *text, lcduint_t *height)
 {
     lcduint_t width = 0;
-    while ( *text )
+    SGlyphRecord glyph;
+    while ( *text != '\r' && *text != '\n' && decodeTextRun(text, &glyph, 1) )
+    {
+        width += glyph.info.width + glyph.info.spacing;
+        if ( height )
+            *height = glyph.info.height;
+    }
+    return width;
+}
+
+uint16_t NanoFont::decodeTextRun(const char *&text, SGlyphRecord *glyphs, uint16_t maxGlyphs)
+{
+    uint16_t count = 0;
+    while ( count < maxGlyphs && *text )
     {
-        if ( *text == '\r' || *text == '\n' )
+        uint32_t unicode = nano_utf8_decode(&text, nullptr);
+        if ( unicode == '\r' )
         {
-            break;
+            continue;
         }
-        uint16_t unicode = unicode16FromUtf8(*text);
-        if ( unicode != SSD1306_MORE_CHARS_REQUIRED )
+        SGlyphRecord &glyph = glyphs[count++];
+        if ( unicode == '\n' )
         {
-            SCharInfo char_info;
-            getCharBitmap(unicode, &char_info);
-            width += char_info.width + char_info.spacing;
-            if ( height )
-                *height = char_info.height;
+            glyph.unicode = '\n';
+            glyph.info = SCharInfo{};
+            continue;
         }
-        text++;
+        glyph.unicode = unicode > 0xFFFD ? 0xFFFD : static_cast<uint16_t>(unicode);
+        getCharBitmap(glyph.unicode, &glyph.info);
+    }
+    return count;
+}
+
+lcduint_t NanoFont::getTextRunWidth(const SGlyphRecord *glyphs, uint16_t count)
+{
+    lcduint_t width = 0;
+    while ( count-- )
+    {
+        width += glyphs->info.width + glyphs->info.spacing;
+        glyphs++;
     }
     return width;
 }
 
+uint16_t NanoFont::wrapTextRun(const SGlyphRecord *glyphs, uint16_t count, uint16_t start, lcduint_t maxWidth,
+                               uint16_t &lineCount)
+{
+    lcduint_t width = 0;
+    uint16_t space = count;
+    for ( uint16_t i = start; i < count; i++ )
+    {
+        if ( glyphs[i].unicode == '\n' )
+        {
+            lineCount = i - start;
+            return i + 1;
+        }
+        if ( maxWidth && i > start && width + glyphs[i].info.width > maxWidth )
+        {
+            if ( glyphs[i].unicode != ' ' && space < i )
+            {
+                i = space;
+            }
+            lineCount = i - start;
+            // Spaces at the line break are not moved to the next line
+            while ( i < count && glyphs[i].unicode == ' ' )
+            {
+                i++;
+            }
+            return i;
+        }
+        if ( glyphs[i].unicode == ' ' )
+        {
+            space = i;
+        }
+        width += glyphs[i].info.width + glyphs[i].info.spacing;
+    }
+    lineCount = count - start;
+    return count;
+}
+
 uint16_t NanoFont::unicode16FromUtf8(uint8_t ch)
 {
 #ifdef CONFIG_SSD1306_UNICODE_ENABLE
@@ -38,6 +38,25 @@
 /** Flag means that more chars are required to decode utf-8 */
 #define SSD1306_MORE_CHARS_REQUIRED 0xffff
 
+#ifndef NANO_FONT_CACHE_SIZE
+#if defined(__AVR__)
+/**
+ * Number of recently used glyphs, remembered by NanoFont (power of 2).
+ * 0 disables the cache.
+ */
+#define NANO_FONT_CACHE_SIZE 0
+#else
+#define NANO_FONT_CACHE_SIZE 16
+#endif
+#endif
+
+/** Glyph record of text run, decoded by NanoFont::decodeTextRun() */
+typedef struct
+{
+    uint16_t unicode; ///< unicode code point, '\n' for line break
+    SCharInfo info;   ///< glyph bitmap and metrics
+} SGlyphRecord;
+
 /**
  * NanoFont class implements work with fonts provided by
  * the library: loading fonts, providing their parameters
@@ -52,6 +71,7 @@ public:
      */
     NanoFont()
     {
+        resetCache();
     }
 
     /**
@@ -126,6 +146,48 @@ public:
      */
     lcduint_t getTextSize(const char *text, lcduint_t *height = nullptr);
 
+    /**
+     * @brief Decodes utf-8 text into glyph records
+     *
+     * Decodes utf-8 text once, so that it can be measured, wrapped and drawn without
+     * decoding it and looking up glyphs again. Unlike unicode16FromUtf8(), the function
+     * keeps no state between calls. Decoding stops at the end of text or when glyphs
+     * buffer is full: text pointer is advanced past decoded characters, so long text
+     * can be processed in chunks. Carriage returns are skipped, invalid sequences are
+     * decoded as U+FFFD.
+     *
+     * @param text in/out pointer to null-terminated utf-8 text
+     * @param glyphs buffer to fill with glyph records
+     * @param maxGlyphs size of glyphs buffer
+     * @return number of glyph records written
+     */
+    uint16_t decodeTextRun(const char *&text, SGlyphRecord *glyphs, uint16_t maxGlyphs);
+
+    /**
+     * Returns width of glyph records in pixels, including spacing after each glyph
+     *
+     * @param glyphs glyph records, decoded by decodeTextRun()
+     * @param count number of glyph records
+     */
+    static lcduint_t getTextRunWidth(const SGlyphRecord *glyphs, uint16_t count);
+
+    /**
+     * @brief Finds line of text run, which fits specified width
+     *
+     * Finds line of text run, starting at glyph start. Lines are broken at '\n' and,
+     * if the line does not fit maxWidth, after the last space. Words longer than
+     * maxWidth are broken at glyph boundary.
+     *
+     * @param glyphs glyph records, decoded by decodeTextRun()
+     * @param count number of glyph records
+     * @param start index of first glyph of the line
+     * @param maxWidth maximum width of the line in pixels, 0 for no limit
+     * @param lineCount receives number of glyphs to draw for the line
+     * @return index of first glyph of the next line, count if there are no more lines
+     */
+    static uint16_t wrapTextRun(const SGlyphRecord *glyphs, uint16_t count, uint16_t start, lcduint_t maxWidth,
+                                uint16_t &lineCount);
+
     /**
      * Returns 16-bit unicode char, encoded in utf8
      *         SSD1306_MORE_CHARS_REQUIRED if more characters is expected
@@ -152,6 +214,7 @@ public:
     void setSpacing(uint8_t spacing)
     {
         m_fixedFont.spacing = spacing;
+        resetCache();
     }
 
     /**
@@ -163,6 +226,15 @@ public:
         return m_fixedFont.pages;
     }
 
+    /**
+     * Returns number, which changes each time a font is loaded or font parameters
+     * are changed. Use it to drop text measurements, cached outside of the font.
+     */
+    uint8_t getRevision() const
+    {
+        return m_revision;
+    }
+
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
     const uint8_t *getPrimaryTable()
     {
@@ -172,8 +244,26 @@ public:
 
 private:
     SFixedFontInfo m_fixedFont{};
+    uint8_t m_revision = 0;
+#if NANO_FONT_CACHE_SIZE > 0
+    uint16_t m_cacheCode[NANO_FONT_CACHE_SIZE];
+    SCharInfo m_cacheInfo[NANO_FONT_CACHE_SIZE];
+#endif
 
     void (*m_getCharBitmap)(const SFixedFontInfo &font, uint16_t unicode, SCharInfo *info) = nullptr;
+
+    void buildIndex();
+
+    void resetCache()
+    {
+        m_revision++;
+#if NANO_FONT_CACHE_SIZE > 0
+        for ( uint8_t i = 0; i < NANO_FONT_CACHE_SIZE; i++ )
+        {
+            m_cacheCode[i] = SSD1306_MORE_CHARS_REQUIRED;
+        }
+#endif
+    }
 };
 
 extern NanoFont g_canvas_font;
@@ -0,0 +1,299 @@
+/*
+    MIT License
+
+    Copyright (c) 2026, Alexey Dynda
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+/**
+ * @file canvas/internal/canvas_kernels.h Pixel kernels for 8-bit and 16-bit buffers
+ *
+ * 16-bit pixels are stored high byte first, as they are sent to the display.
+ * On Linux hosts with SSE2 (x86) or NEON (ARM) the kernels are vectorized,
+ * other platforms get scalar implementation. Define CONFIG_LCDGFX_NO_SIMD to
+ * force scalar implementation.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+#if !defined(CONFIG_LCDGFX_NO_SIMD) && !defined(ARDUINO) && !defined(__AVR__)
+#if defined(__SSE2__)
+#include <emmintrin.h>
+/** Defined, when canvas kernels use SSE2 instructions */
+#define CANVAS_SIMD_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+/** Defined, when canvas kernels use NEON instructions */
+#define CANVAS_SIMD_NEON
+#endif
+#endif
+
+#if defined(CANVAS_SIMD_SSE2) || defined(CANVAS_SIMD_NEON)
+/**
+ * Defined, when canvas kernels are vectorized. Such hosts have no separate
+ * flash address space, so the kernels can read bitmaps directly.
+ */
+#define CANVAS_SIMD
+#endif
+
+/**
+ * Fills count 16-bit pixels with color
+ * @param dst - destination buffer
+ * @param color - 16-bit color
+ * @param count - number of pixels
+ */
+static inline void canvas_fill16(uint8_t *dst, uint16_t color, uint32_t count)
+{
+#if defined(CANVAS_SIMD_SSE2)
+    // x86 is little-endian: swapped color is stored high byte first
+    __m128i v = _mm_set1_epi16((short)((color >> 8) | (color << 8)));
+    for ( ; count >= 8; count -= 8, dst += 16 )
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), v);
+    }
+#elif defined(CANVAS_SIMD_NEON)
+    uint8x16x2_t v = {{vdupq_n_u8(color >> 8), vdupq_n_u8(color & 0xFF)}};
+    for ( ; count >= 16; count -= 16, dst += 32 )
+    {
+        vst2q_u8(dst, v);
+    }
+#endif
+    while ( count-- )
+    {
+        dst[0] = color >> 8;
+        dst[1] = color & 0xFF;
+        dst += 2;
+    }
+}
+
+/**
+ * Converts count 8-bit RGB pixels (3-3-2) to 16-bit pixels (5-6-5), see RGB8_TO_RGB16().
+ * @param dst - destination buffer of count * 2 bytes
+ * @param src - source pixels
+ * @param count - number of pixels
+ * @param transparent - if true, black source pixels do not overwrite destination
+ */
+static inline void canvas_rgb8to16(uint8_t *dst, const uint8_t *src, uint32_t count, bool transparent)
+{
+    // high byte is RRRGGG00 | 00000GGG, low byte is 000BB000
+#if defined(CANVAS_SIMD_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i maskRG = _mm_set1_epi8((char)0xE0);
+    const __m128i maskG = _mm_set1_epi8(0x07);
+    const __m128i maskB = _mm_set1_epi8(0x03);
+    for ( ; count >= 16; count -= 16, src += 16, dst += 32 )
+    {
+        __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+        __m128i hi = _mm_or_si128(_mm_and_si128(c, maskRG), _mm_and_si128(_mm_srli_epi16(c, 2), maskG));
+        __m128i lo = _mm_slli_epi16(_mm_and_si128(c, maskB), 3);
+        __m128i p0 = _mm_unpacklo_epi8(hi, lo);
+        __m128i p1 = _mm_unpackhi_epi8(hi, lo);
+        if ( transparent )
+        {
+            __m128i black = _mm_cmpeq_epi8(c, zero);
+            __m128i m0 = _mm_unpacklo_epi8(black, black);
+            __m128i m1 = _mm_unpackhi_epi8(black, black);
+            __m128i d0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(dst));
+            __m128i d1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(dst + 16));
+            p0 = _mm_or_si128(_mm_andnot_si128(m0, p0), _mm_and_si128(m0, d0));
+            p1 = _mm_or_si128(_mm_andnot_si128(m1, p1), _mm_and_si128(m1, d1));
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), p0);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + 16), p1);
+    }
+#elif defined(CANVAS_SIMD_NEON)
+    for ( ; count >= 16; count -= 16, src += 16, dst += 32 )
+    {
+        uint8x16_t c = vld1q_u8(src);
+        uint8x16x2_t p;
+        p.val[0] = vorrq_u8(vandq_u8(c, vdupq_n_u8(0xE0)), vandq_u8(vshrq_n_u8(c, 2), vdupq_n_u8(0x07)));
+        p.val[1] = vshlq_n_u8(vandq_u8(c, vdupq_n_u8(0x03)), 3);
+        if ( transparent )
+        {
+            uint8x16_t black = vceqq_u8(c, vdupq_n_u8(0));
+            uint8x16x2_t d = vld2q_u8(dst);
+            p.val[0] = vbslq_u8(black, d.val[0], p.val[0]);
+            p.val[1] = vbslq_u8(black, d.val[1], p.val[1]);
+        }
+        vst2q_u8(dst, p);
+    }
+#endif
+    while ( count-- )
+    {
+        uint8_t c = *src++;
+        if ( c || !transparent )
+        {
+            dst[0] = (c & 0xE0) | ((c >> 2) & 0x07);
+            dst[1] = (c & 0x03) << 3;
+        }
+        dst += 2;
+    }
+}
+
+/**
+ * Copies count 16-bit pixels
+ * @param dst - destination buffer
+ * @param src - source pixels
+ * @param count - number of pixels
+ * @param transparent - if true, black source pixels do not overwrite destination
+ */
+static inline void canvas_copy16(uint8_t *dst, const uint8_t *src, uint32_t count, bool transparent)
+{
+    if ( !transparent )
+    {
+        memcpy(dst, src, count * 2);
+        return;
+    }
+#if defined(CANVAS_SIMD_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    for ( ; count >= 8; count -= 8, src += 16, dst += 16 )
+    {
+        __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+        __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i *>(dst));
+        __m128i black = _mm_cmpeq_epi16(s, zero);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst),
+                         _mm_or_si128(_mm_andnot_si128(black, s), _mm_and_si128(black, d)));
+    }
+#elif defined(CANVAS_SIMD_NEON)
+    for ( ; count >= 8; count -= 8, src += 16, dst += 16 )
+    {
+        uint8x16_t s = vld1q_u8(src);
+        uint8x16_t black = vreinterpretq_u8_u16(vceqq_u16(vreinterpretq_u16_u8(s), vdupq_n_u16(0)));
+        vst1q_u8(dst, vbslq_u8(black, vld1q_u8(dst), s));
+    }
+#endif
+    while ( count-- )
+    {
+        if ( src[0] || src[1] )
+        {
+            dst[0] = src[0];
+            dst[1] = src[1];
+        }
+        src += 2;
+        dst += 2;
+    }
+}
+
+/** Size of lookup table in bytes, built by canvas_lut1() for bytesPerPixel */
+#define CANVAS_LUT1_SIZE(bytesPerPixel) (16 * 4 * (bytesPerPixel))
+
+/**
+ * Builds lookup table for 1-bit pixels expansion: each of 16 entries holds
+ * 4 native pixels for 4 bits of a nibble, least significant bit first.
+ * @param lut - table of CANVAS_LUT1_SIZE(bytesPerPixel) bytes
+ * @param fg - color of set bits
+ * @param bg - color of cleared bits
+ * @param bytesPerPixel - 1 or 2
+ */
+static inline void canvas_lut1(uint8_t *lut, uint16_t fg, uint16_t bg, uint8_t bytesPerPixel)
+{
+    for ( uint8_t n = 0; n < 16; n++ )
+    {
+        for ( uint8_t i = 0; i < 4; i++ )
+        {
+            uint16_t color = (n & (1 << i)) ? fg : bg;
+            if ( bytesPerPixel == 2 )
+            {
+                *lut++ = color >> 8;
+            }
+            *lut++ = color & 0xFF;
+        }
+    }
+}
+
+/**
+ * Collects one row of 8 pixels from 8 column bytes of a page.
+ * @param cols - 8 column bytes, each byte holds 8 vertical pixels, LSB on top
+ * @param bit - row in the page, 0 - 7
+ * @return row bits, bit 0 is pixel of the first column
+ */
+static inline uint8_t canvas_gather1(const uint8_t *cols, uint8_t bit)
+{
+#if defined(CANVAS_SIMD) && defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+    // move bit 8*k of masked word to bit 56+k in a single multiply
+    uint64_t data;
+    memcpy(&data, cols, 8);
+    return (((data >> bit) & 0x0101010101010101ULL) * 0x0102040810204080ULL) >> 56;
+#else
+    uint8_t bits = 0;
+    for ( uint8_t k = 0; k < 8; k++ )
+    {
+        bits |= ((cols[k] >> bit) & 1) << k;
+    }
+    return bits;
+#endif
+}
+
+/**
+ * Writes up to 8 native pixels for row bits, using table, built by canvas_lut1().
+ * @param dst - destination buffer
+ * @param bits - row bits, bit 0 is the first pixel
+ * @param count - number of pixels, 1 - 8
+ * @param lut - lookup table
+ * @param bytesPerPixel - 1 or 2
+ * @param transparent - if true, cleared bits do not overwrite destination
+ */
+static inline void canvas_expand1(uint8_t *dst, uint8_t bits, uint8_t count, const uint8_t *lut,
+                                  uint8_t bytesPerPixel, bool transparent)
+{
+    const uint8_t size = 4 * bytesPerPixel;
+    if ( count == 8 && !transparent )
+    {
+        memcpy(dst, lut + (bits & 0x0F) * size, size);
+        memcpy(dst + size, lut + (bits >> 4) * size, size);
+        return;
+    }
+    while ( count-- )
+    {
+        if ( (bits & 1) || !transparent )
+        {
+            // entry 1 starts with set pixel, entry 0 with cleared one
+            memcpy(dst, lut + (bits & 1) * size, bytesPerPixel);
+        }
+        bits >>= 1;
+        dst += bytesPerPixel;
+    }
+}
+
+/**
+ * Expands one row of page-oriented 1-bit buffer to native pixels.
+ * @param dst - destination buffer of count * bytesPerPixel bytes
+ * @param cols - column bytes of the page in RAM
+ * @param count - number of pixels
+ * @param bit - row in the page, 0 - 7
+ * @param lut - table, built by canvas_lut1()
+ * @param bytesPerPixel - 1 or 2
+ */
+static inline void canvas_row1(uint8_t *dst, const uint8_t *cols, uint16_t count, uint8_t bit, const uint8_t *lut,
+                               uint8_t bytesPerPixel)
+{
+    for ( ; count >= 8; count -= 8, cols += 8, dst += 8 * bytesPerPixel )
+    {
+        canvas_expand1(dst, canvas_gather1(cols, bit), 8, lut, bytesPerPixel, false);
+    }
+    if ( count )
+    {
+        uint8_t tail[8] = {0};
+        memcpy(tail, cols, count);
+        canvas_expand1(dst, canvas_gather1(tail, bit), count, lut, bytesPerPixel, false);
+    }
+}
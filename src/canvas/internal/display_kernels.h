@@ -0,0 +1,78 @@
+/*
+    MIT License
+
+    Copyright (c) 2026, Alexey Dynda
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+/**
+ * @file canvas/internal/display_kernels.h Pixel conversion for display buffers
+ *
+ * Out-of-line wrappers of canvas kernels, used by display templates. They keep
+ * SIMD intrinsics and inline kernels of canvas_kernels.h out of user code,
+ * which includes display headers.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+/** Size of lookup table in bytes, built by display_lut1() for bytesPerPixel */
+#define DISPLAY_LUT1_SIZE(bytesPerPixel) (16 * 4 * (bytesPerPixel))
+
+/**
+ * Builds lookup table for 1-bit pixels expansion.
+ * @param lut - table of DISPLAY_LUT1_SIZE(bytesPerPixel) bytes
+ * @param fg - color of set bits
+ * @param bg - color of cleared bits
+ * @param bytesPerPixel - 1 or 2
+ */
+void display_lut1(uint8_t *lut, uint16_t fg, uint16_t bg, uint8_t bytesPerPixel);
+
+/**
+ * Expands one row of up to 8 columns of a page to native pixels.
+ * @param dst - destination buffer of count * bytesPerPixel bytes
+ * @param cols - 8 column bytes in RAM, unused columns must be 0
+ * @param count - number of pixels, 1 - 8
+ * @param bit - row in the page, 0 - 7
+ * @param lut - table, built by display_lut1()
+ * @param bytesPerPixel - 1 or 2
+ */
+void display_expand1(uint8_t *dst, const uint8_t *cols, uint8_t count, uint8_t bit, const uint8_t *lut,
+                     uint8_t bytesPerPixel);
+
+/**
+ * Expands one row of page-oriented 1-bit buffer to native pixels.
+ * @param dst - destination buffer of count * bytesPerPixel bytes
+ * @param cols - column bytes of the page in RAM
+ * @param count - number of pixels
+ * @param bit - row in the page, 0 - 7
+ * @param lut - table, built by display_lut1()
+ * @param bytesPerPixel - 1 or 2
+ */
+void display_row1(uint8_t *dst, const uint8_t *cols, uint16_t count, uint8_t bit, const uint8_t *lut,
+                  uint8_t bytesPerPixel);
+
+/**
+ * Converts RGB8 pixels to 16-bit pixels, high byte first.
+ * @param dst - destination buffer of count * 2 bytes
+ * @param src - RGB8 pixels
+ * @param count - number of pixels
+ */
+void display_rgb8to16(uint8_t *dst, const uint8_t *src, uint32_t count);
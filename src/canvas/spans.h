@@ -0,0 +1,431 @@
+/*
+    MIT License
+
+    Copyright (c) 2026, Alexey Dynda
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+/**
+ * @file spans.h Scanline rasterizers for filled shapes
+ *
+ * Functions in this file split filled shapes into horizontal spans, and send each
+ * span to the target via drawHLine(x1, y, x2), so every row of the shape costs
+ * single span operation of canvas or single address window of display.
+ * Target can be any class with drawHLine() and fillRect() methods: NanoCanvasOps or
+ * NanoDisplayOps.
+ */
+
+#ifndef _NANO_SPANS_H_
+#define _NANO_SPANS_H_
+
+#include "point.h"
+
+/**
+ * @ingroup NANO_ENGINE_API_V2
+ * @{
+ */
+
+#ifndef NANO_POLYGON_MAX_NODES
+#if defined(__AVR__)
+/** Maximum number of polygon edges, crossing single row */
+#define NANO_POLYGON_MAX_NODES 8
+#else
+/** Maximum number of polygon edges, crossing single row */
+#define NANO_POLYGON_MAX_NODES 32
+#endif
+#endif
+
+/**
+ * Iterates over rows of circle, produced by the same midpoint algorithm as drawCircle():
+ * each row offset from the center is returned exactly once together with half width
+ * of the circle at that row, so filled circle matches outline of drawCircle().
+ * Rows are not returned in order.
+ */
+class NanoCircleSpans
+{
+public:
+    /**
+     * Creates iterator for circle of radius r
+     * @param r - radius of circle in pixels
+     */
+    explicit NanoCircleSpans(lcdint_t r)
+        : m_d(3 - 2 * (int16_t)r)
+        , m_y(r)
+        , m_lastY(r)
+        , m_r(r)
+    {
+    }
+
+    /**
+     * Returns next row of circle
+     * @param dy - row offset from the center, 0...r
+     * @param hw - half width of the circle at the row
+     * @return false if there are no more rows
+     */
+    bool next(lcdint_t &dy, lcdint_t &hw)
+    {
+        if ( m_pending )
+        {
+            m_pending = false;
+            dy = m_pendingY;
+            hw = m_pendingW;
+            return true;
+        }
+        if ( m_stage == 0 )
+        {
+            m_stage = m_r > 0 ? 1 : 3;
+            dy = 0;
+            hw = m_r > 0 ? m_r : 0;
+            return true;
+        }
+        while ( m_stage == 1 )
+        {
+            if ( m_y < m_x )
+            {
+                m_stage = 2;
+                break;
+            }
+            m_x++;
+            if ( m_d > 0 )
+            {
+                m_y--;
+                m_d += -4 * m_y + 4;
+            }
+            m_d += 4 * m_x + 6;
+            // Rows (yc +/- y) are complete, when y changes: their width is the last x
+            bool rowDone = false;
+            if ( m_y != m_lastY )
+            {
+                rowDone = m_lastY > m_lastX;
+                dy = m_lastY;
+                hw = m_x - 1;
+                m_lastY = m_y;
+            }
+            // Rows (yc +/- x) get width y once, while they are above the diagonal
+            if ( m_x <= m_y )
+            {
+                m_lastX = m_x;
+                if ( rowDone )
+                {
+                    m_pending = true;
+                    m_pendingY = m_x;
+                    m_pendingW = m_y;
+                    return true;
+                }
+                dy = m_x;
+                hw = m_y;
+                return true;
+            }
+            if ( rowDone )
+            {
+                return true;
+            }
+        }
+        if ( m_stage == 2 )
+        {
+            m_stage = 3;
+            if ( m_lastY > m_lastX )
+            {
+                dy = m_lastY;
+                hw = m_x;
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    int16_t m_d;
+    lcdint_t m_x = 0;
+    lcdint_t m_y;
+    lcdint_t m_lastY;
+    lcdint_t m_lastX = 0;
+    lcdint_t m_r;
+    lcdint_t m_pendingY = 0;
+    lcdint_t m_pendingW = 0;
+    uint8_t m_stage = 0;
+    bool m_pending = false;
+};
+
+/**
+ * Swaps content of a and b
+ */
+template <typename V> static inline void nano_swap(V &a, V &b)
+{
+    V t = a;
+    a = b;
+    b = t;
+}
+
+/**
+ * Returns integer square root of the value
+ * @param value - value to get square root of
+ */
+static inline uint32_t nano_isqrt(uint32_t value)
+{
+    uint32_t result = 0;
+    uint32_t bit = 1UL << 30;
+    while ( bit > value )
+    {
+        bit >>= 2;
+    }
+    while ( bit )
+    {
+        if ( value >= result + bit )
+        {
+            value -= result + bit;
+            result = (result >> 1) + bit;
+        }
+        else
+        {
+            result >>= 1;
+        }
+        bit >>= 2;
+    }
+    return result;
+}
+
+/**
+ * Fills circle with spans
+ * @param t - target to draw on
+ * @param xc - horizontal position of circle center in pixels
+ * @param yc - vertical position of circle center in pixels
+ * @param r - radius of circle in pixels
+ */
+template <class T> void nano_fillCircle(T &t, lcdint_t xc, lcdint_t yc, lcdint_t r)
+{
+    NanoCircleSpans spans(r);
+    lcdint_t dy, hw;
+    while ( spans.next(dy, hw) )
+    {
+        t.drawHLine(xc - hw, yc + dy, xc + hw);
+        if ( dy )
+        {
+            t.drawHLine(xc - hw, yc - dy, xc + hw);
+        }
+    }
+}
+
+/**
+ * Fills rectangle with rounded corners: corner rows are sent as spans, the middle
+ * part as single rectangle.
+ * @param t - target to draw on
+ * @param x1 - left position in pixels
+ * @param y1 - top position in pixels
+ * @param x2 - right position in pixels
+ * @param y2 - bottom position in pixels
+ * @param r - radius of corners in pixels
+ */
+template <class T>
+void nano_fillRoundRect(T &t, lcdint_t x1, lcdint_t y1, lcdint_t x2, lcdint_t y2, lcdint_t r)
+{
+    if ( x1 > x2 )
+    {
+        nano_swap(x1, x2);
+    }
+    if ( y1 > y2 )
+    {
+        nano_swap(y1, y2);
+    }
+    if ( r > (x2 - x1) / 2 )
+    {
+        r = (x2 - x1) / 2;
+    }
+    if ( r > (y2 - y1) / 2 )
+    {
+        r = (y2 - y1) / 2;
+    }
+    if ( r <= 0 )
+    {
+        t.fillRect(x1, y1, x2, y2);
+        return;
+    }
+    NanoCircleSpans spans(r);
+    lcdint_t dy, hw;
+    while ( spans.next(dy, hw) )
+    {
+        if ( dy )
+        {
+            t.drawHLine(x1 + r - hw, y1 + r - dy, x2 - r + hw);
+            t.drawHLine(x1 + r - hw, y2 - r + dy, x2 - r + hw);
+        }
+    }
+    t.fillRect(x1, y1 + r, x2, y2 - r);
+}
+
+/**
+ * Fills triangle with spans
+ * @param t - target to draw on
+ * @param x1 - position X of the first vertex
+ * @param y1 - position Y of the first vertex
+ * @param x2 - position X of the second vertex
+ * @param y2 - position Y of the second vertex
+ * @param x3 - position X of the third vertex
+ * @param y3 - position Y of the third vertex
+ */
+template <class T>
+void nano_fillTriangle(T &t, lcdint_t x1, lcdint_t y1, lcdint_t x2, lcdint_t y2, lcdint_t x3, lcdint_t y3)
+{
+    if ( y1 > y2 )
+    {
+        nano_swap(x1, x2);
+        nano_swap(y1, y2);
+    }
+    if ( y2 > y3 )
+    {
+        nano_swap(x2, x3);
+        nano_swap(y2, y3);
+    }
+    if ( y1 > y2 )
+    {
+        nano_swap(x1, x2);
+        nano_swap(y1, y2);
+    }
+    if ( y1 == y3 )
+    {
+        lcdint_t a = x1 < x2 ? (x1 < x3 ? x1 : x3) : (x2 < x3 ? x2 : x3);
+        lcdint_t b = x1 > x2 ? (x1 > x3 ? x1 : x3) : (x2 > x3 ? x2 : x3);
+        t.drawHLine(a, y1, b);
+        return;
+    }
+    for ( lcdint_t y = y1; y <= y3; y++ )
+    {
+        lcdint_t a = x1 + (int32_t)(x3 - x1) * (y - y1) / (y3 - y1);
+        lcdint_t b;
+        if ( y < y2 )
+        {
+            b = x1 + (int32_t)(x2 - x1) * (y - y1) / (y2 - y1);
+        }
+        else if ( y2 == y3 )
+        {
+            b = x2;
+        }
+        else
+        {
+            b = x2 + (int32_t)(x3 - x2) * (y - y2) / (y3 - y2);
+        }
+        if ( a > b )
+        {
+            nano_swap(a, b);
+        }
+        t.drawHLine(a, y, b);
+    }
+}
+
+/**
+ * Fills convex or concave polygon with spans, using even-odd rule. Each row is
+ * sampled at the pixel row: the edge covers rows from its top vertex up to, but not
+ * including, its bottom vertex, except for the lowest row of the polygon.
+ * @param t - target to draw on
+ * @param points - polygon vertices
+ * @param count - number of vertices
+ * @note Only NANO_POLYGON_MAX_NODES edges, crossing the same row, are taken into account.
+ */
+template <class T> void nano_fillPolygon(T &t, const NanoPoint *points, uint8_t count)
+{
+    if ( !count )
+    {
+        return;
+    }
+    lcdint_t top = points[0].y;
+    lcdint_t bottom = points[0].y;
+    for ( uint8_t i = 1; i < count; i++ )
+    {
+        top = points[i].y < top ? points[i].y : top;
+        bottom = points[i].y > bottom ? points[i].y : bottom;
+    }
+    lcdint_t nodes[NANO_POLYGON_MAX_NODES];
+    for ( lcdint_t y = top; y <= bottom; y++ )
+    {
+        uint8_t n = 0;
+        for ( uint8_t i = 0, j = count - 1; i < count; j = i++ )
+        {
+            const NanoPoint &a = points[i];
+            const NanoPoint &b = points[j];
+            bool crosses = y < bottom ? ((a.y <= y) != (b.y <= y)) : ((a.y < y) != (b.y < y));
+            if ( crosses && n < NANO_POLYGON_MAX_NODES )
+            {
+                lcdint_t x = a.x + (int32_t)(b.x - a.x) * (y - a.y) / (b.y - a.y);
+                uint8_t k = n++;
+                for ( ; k > 0 && nodes[k - 1] > x; k-- )
+                {
+                    nodes[k] = nodes[k - 1];
+                }
+                nodes[k] = x;
+            }
+        }
+        for ( uint8_t k = 1; k < n; k += 2 )
+        {
+            t.drawHLine(nodes[k - 1], y, nodes[k]);
+        }
+    }
+}
+
+/**
+ * Draws line of specified width as filled polygon. Horizontal and vertical lines are
+ * drawn as single rectangle.
+ * @param t - target to draw on
+ * @param x1 - start position X
+ * @param y1 - start position Y
+ * @param x2 - end position X
+ * @param y2 - end position Y
+ * @param width - width of the line in pixels
+ */
+template <class T>
+void nano_drawThickLine(T &t, lcdint_t x1, lcdint_t y1, lcdint_t x2, lcdint_t y2, lcduint_t width)
+{
+    if ( width <= 1 )
+    {
+        t.drawLine(x1, y1, x2, y2);
+        return;
+    }
+    // the line occupies (width - 1) / 2 pixels on one side and the rest on the other one
+    lcdint_t a = (width - 1) / 2;
+    lcdint_t b = (width - 1) - a;
+    if ( y1 == y2 )
+    {
+        t.fillRect(x1, y1 - a, x2, y1 + b);
+        return;
+    }
+    if ( x1 == x2 )
+    {
+        t.fillRect(x1 - a, y1, x1 + b, y2);
+        return;
+    }
+    int32_t dx = x2 - x1;
+    int32_t dy = y2 - y1;
+    int32_t len = nano_isqrt(dx * dx + dy * dy);
+    // perpendicular (-dy, dx), scaled to the line sides with rounding
+    lcdint_t ax = (-dy * a * 2 + (dy > 0 ? -len : len)) / (len * 2);
+    lcdint_t ay = (dx * a * 2 + (dx > 0 ? len : -len)) / (len * 2);
+    lcdint_t bx = (dy * b * 2 + (dy > 0 ? len : -len)) / (len * 2);
+    lcdint_t by = (-dx * b * 2 + (dx > 0 ? -len : len)) / (len * 2);
+    NanoPoint points[4];
+    points[0].setPoint(x1 + ax, y1 + ay);
+    points[1].setPoint(x2 + ax, y2 + ay);
+    points[2].setPoint(x2 + bx, y2 + by);
+    points[3].setPoint(x1 + bx, y1 + by);
+    nano_fillPolygon(t, points, 4);
+}
+
+/**
+ * @}
+ */
+
+#endif
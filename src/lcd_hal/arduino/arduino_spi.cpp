@@ -102,6 +102,23 @@ void ArduinoSpi::sendBuffer(const uint8_t *buffer, uint16_t size)
     };
 }
 
+void ArduinoSpi::sendRepeat(uint8_t data, uint32_t count)
+{
+    while ( count-- )
+    {
+        send(data);
+    }
+}
+
+void ArduinoSpi::sendRepeat16(uint16_t data, uint32_t count)
+{
+    while ( count-- )
+    {
+        send(data >> 8);
+        send(data & 0xFF);
+    }
+}
+
 #endif
 
 #if defined(CONFIG_ARDUINO_SPI2_AVAILABLE) && defined(CONFIG_ARDUINO_SPI_ENABLE)
@@ -171,6 +188,23 @@ void ArduinoSpi2::sendBuffer(const uint8_t *buffer, uint16_t size)
     };
 }
 
+void ArduinoSpi2::sendRepeat(uint8_t data, uint32_t count)
+{
+    while ( count-- )
+    {
+        send(data);
+    }
+}
+
+void ArduinoSpi2::sendRepeat16(uint16_t data, uint32_t count)
+{
+    while ( count-- )
+    {
+        send(data >> 8);
+        send(data & 0xFF);
+    }
+}
+
 #endif
 
 #endif // ARDUINO
@@ -121,6 +121,23 @@ void ArduinoI2c::sendBuffer(const uint8_t *buffer, uint16_t size)
     }
 }
 
+void ArduinoI2c::sendRepeat(uint8_t data, uint32_t count)
+{
+    while ( count-- )
+    {
+        send(data);
+    }
+}
+
+void ArduinoI2c::sendRepeat16(uint16_t data, uint32_t count)
+{
+    while ( count-- )
+    {
+        send(data >> 8);
+        send(data & 0xFF);
+    }
+}
+
 #endif
 
 #endif // ARDUINO
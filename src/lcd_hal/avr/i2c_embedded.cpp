@@ -261,4 +261,21 @@ void SoftwareI2c::sendBuffer(const uint8_t *buffer, uint16_t size)
     }
 }
 
+void SoftwareI2c::sendRepeat(uint8_t data, uint32_t count)
+{
+    while ( count-- )
+    {
+        send(data);
+    }
+}
+
+void SoftwareI2c::sendRepeat16(uint16_t data, uint32_t count)
+{
+    while ( count-- )
+    {
+        send(data >> 8);
+        send(data & 0xFF);
+    }
+}
+
 #endif
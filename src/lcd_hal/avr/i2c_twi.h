@@ -83,6 +83,24 @@ public:
      */
     void sendBuffer(const uint8_t *buffer, uint16_t size);
 
+    /**
+     * Sends the same byte to the device count times.
+     * Display operations use it to fill areas with a single color.
+     *
+     * @param data - byte to send
+     * @param count - number of times to send the byte
+     */
+    void sendRepeat(uint8_t data, uint32_t count);
+
+    /**
+     * Sends 16-bit value to the device count times, high byte first.
+     * Display operations use it to fill areas with a single 16-bit color.
+     *
+     * @param data - 16-bit value to send
+     * @param count - number of times to send the value
+     */
+    void sendRepeat16(uint16_t data, uint32_t count);
+
     /**
      * Sets i2c address for communication
      * This API is required for some led displays having multiple
@@ -144,4 +144,35 @@ void AvrSpi::sendBuffer(const uint8_t *buffer, uint16_t size)
     }
 }
 
+void AvrSpi::sendRepeat(uint8_t data, uint32_t count)
+{
+    while ( count-- )
+    {
+        SPDR = data;
+        asm volatile("nop"); // to improve speed
+        while ( (SPSR & (1 << SPIF)) == 0 )
+            ;
+        SPDR; // read SPI input
+    }
+}
+
+void AvrSpi::sendRepeat16(uint16_t data, uint32_t count)
+{
+    uint8_t hi = data >> 8;
+    uint8_t lo = data & 0xFF;
+    while ( count-- )
+    {
+        SPDR = hi;
+        asm volatile("nop"); // to improve speed
+        while ( (SPSR & (1 << SPIF)) == 0 )
+            ;
+        SPDR; // read SPI input
+        SPDR = lo;
+        asm volatile("nop");
+        while ( (SPSR & (1 << SPIF)) == 0 )
+            ;
+        SPDR;
+    }
+}
+
 #endif
@@ -114,4 +114,21 @@ void UsiSpi::sendBuffer(const uint8_t *buffer, uint16_t size)
     };
 }
 
+void UsiSpi::sendRepeat(uint8_t data, uint32_t count)
+{
+    while ( count-- )
+    {
+        send(data);
+    }
+}
+
+void UsiSpi::sendRepeat16(uint16_t data, uint32_t count)
+{
+    while ( count-- )
+    {
+        send(data >> 8);
+        send(data & 0xFF);
+    }
+}
+
 #endif
@@ -0,0 +1,287 @@
+/*
+    MIT License
+
+    Copyright (c) 2026, Alexey Dynda
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+/*
+ * @file lcd_hal/counting_bus.h Bus wrapper, which collects transfer statistics
+ */
+
+#ifndef _LCD_HAL_COUNTING_BUS_H_
+#define _LCD_HAL_COUNTING_BUS_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+
+/**
+ * Pass as D/C pin to CountingBus of SPI display, which D/C pin cannot be read back.
+ * State of D/C pin is set via CountingBus::setDataMode() in this case.
+ */
+#define COUNTING_BUS_DC_MANUAL (-2)
+
+/**
+ * Transfer statistics, collected by CountingBus
+ */
+typedef struct
+{
+    /** Total number of bytes sent to the bus, including i2c control bytes */
+    uint32_t bytes;
+    /** Number of bytes sent in command mode */
+    uint32_t commandBytes;
+    /** Number of bytes sent in data mode */
+    uint32_t dataBytes;
+    /** Number of i2c control bytes (0x00 / 0x40 prefixes) */
+    uint32_t controlBytes;
+    /** Number of bus transactions (start() calls) */
+    uint32_t transactions;
+    /** Number of send(), sendBuffer() and sendRepeat() calls */
+    uint32_t calls;
+    /**
+     * Number of window setups: switches from command mode to data mode.
+     * startBlock() costs one, and nextBlock() costs one on displays with page addressing
+     * (sh1106, pcd8544), while on other displays nextBlock() does not touch the bus.
+     */
+    uint32_t windows;
+    /** Time in microseconds, spent inside bus transactions */
+    uint32_t busyUs;
+    /** Time in microseconds between beginFrame() and endFrame() */
+    uint32_t frameUs;
+} CountingBusStats;
+
+/**
+ * Template class wraps bus implementation B (PlatformSpi, PlatformI2c, SdlSpi, etc.) and
+ * counts everything sent to the display. Use it in place of bus class for any display,
+ * which accepts custom interface:
+ * @code{.cpp}
+ * DisplaySSD1306_128x64_CustomSPI<CountingBus<PlatformSpi>> display(rstPin, dcPin, dcPin, config);
+ * ...
+ * display.getInterface().beginFrame();
+ * drawScreen();
+ * display.getInterface().endFrame();
+ * const CountingBusStats &stats = display.getInterface().getFrameStats();
+ * @endcode
+ *
+ * For SPI displays command and data bytes are distinguished by reading state of D/C pin
+ * (or by setDataMode() calls for dc = COUNTING_BUS_DC_MANUAL), for i2c displays (dc = -1)
+ * by control byte, which follows start() call.
+ * The wrapper adds lcd_micros() and lcd_gpioRead() calls to each transfer, so it is intended
+ * for profiling only.
+ */
+template <class B> class CountingBus: public B
+{
+public:
+    /**
+     * Creates counting wrapper for bus B
+     *
+     * @param dc data/command pin of SPI display, -1 for i2c displays,
+     *        COUNTING_BUS_DC_MANUAL for SPI displays with D/C state set via setDataMode()
+     * @param args arguments to pass to bus B constructor
+     */
+    template <typename... Args>
+    explicit CountingBus(int8_t dc, Args &&... args)
+        : B(args...)
+        , m_dc(dc)
+    {
+        resetStats();
+    }
+
+    /**
+     * Starts bus transaction
+     */
+    void start()
+    {
+        m_stats.transactions++;
+        m_controlByte = m_dc == -1;
+        m_startTs = lcd_micros();
+        B::start();
+    }
+
+    /**
+     * Completes bus transaction
+     */
+    void stop()
+    {
+        B::stop();
+        m_stats.busyUs += lcd_micros() - m_startTs;
+    }
+
+    /**
+     * Sends byte to the bus
+     * @param data byte to send
+     */
+    void send(uint8_t data)
+    {
+        if ( m_controlByte )
+        {
+            m_controlByte = false;
+            m_dataMode = (data & 0x40) != 0;
+            m_stats.controlBytes++;
+            m_stats.bytes++;
+            m_stats.calls++;
+        }
+        else
+        {
+            count(1);
+        }
+        B::send(data);
+    }
+
+    /**
+     * Sends bytes to the bus
+     * @param buffer bytes to send
+     * @param size number of bytes to send
+     */
+    void sendBuffer(const uint8_t *buffer, uint16_t size)
+    {
+        if ( size && m_controlByte )
+        {
+            send(*buffer++);
+            size--;
+        }
+        if ( size )
+        {
+            count(size);
+            B::sendBuffer(buffer, size);
+        }
+    }
+
+    /**
+     * Sends the same byte to the bus count times
+     * @param data byte to send
+     * @param count number of times to send the byte
+     */
+    void sendRepeat(uint8_t data, uint32_t count)
+    {
+        if ( count && m_controlByte )
+        {
+            send(data);
+            count--;
+        }
+        if ( count )
+        {
+            this->count(count);
+            B::sendRepeat(data, count);
+        }
+    }
+
+    /**
+     * Sends 16-bit value to the bus count times, high byte first
+     * @param data 16-bit value to send
+     * @param count number of times to send the value
+     */
+    void sendRepeat16(uint16_t data, uint32_t count)
+    {
+        this->count(count * 2);
+        B::sendRepeat16(data, count);
+    }
+
+    /**
+     * Sets state of D/C line for bus, created with dc = COUNTING_BUS_DC_MANUAL
+     * @param data true for data mode, false for command mode
+     */
+    void setDataMode(bool data)
+    {
+        m_dataMode = data;
+    }
+
+    /**
+     * Returns statistics, collected since last resetStats() or beginFrame()
+     */
+    const CountingBusStats &getStats() const
+    {
+        return m_stats;
+    }
+
+    /**
+     * Returns statistics of the last frame, completed by endFrame()
+     */
+    const CountingBusStats &getFrameStats() const
+    {
+        return m_frameStats;
+    }
+
+    /**
+     * Resets collected statistics
+     */
+    void resetStats()
+    {
+        m_stats = CountingBusStats{};
+    }
+
+    /**
+     * Resets collected statistics and starts measuring new frame
+     */
+    void beginFrame()
+    {
+        resetStats();
+        m_frameTs = lcd_micros();
+    }
+
+    /**
+     * Completes frame: statistics, collected since beginFrame(), become available
+     * via getFrameStats()
+     */
+    void endFrame()
+    {
+        m_stats.frameUs = lcd_micros() - m_frameTs;
+        m_frameStats = m_stats;
+    }
+
+private:
+    int8_t m_dc;
+    bool m_controlByte = false;
+    bool m_dataMode = false;
+    bool m_pendingWindow = false;
+    uint32_t m_startTs = 0;
+    uint32_t m_frameTs = 0;
+    CountingBusStats m_stats{};
+    CountingBusStats m_frameStats{};
+
+    void count(uint32_t bytes)
+    {
+        if ( m_dc >= 0 )
+        {
+            m_dataMode = lcd_gpioRead(m_dc) == LCD_HIGH;
+        }
+        m_stats.bytes += bytes;
+        m_stats.calls++;
+        if ( m_dataMode )
+        {
+            m_stats.dataBytes += bytes;
+            if ( m_pendingWindow )
+            {
+                m_stats.windows++;
+                m_pendingWindow = false;
+            }
+        }
+        else
+        {
+            m_stats.commandBytes += bytes;
+            m_pendingWindow = true;
+        }
+    }
+};
+
+#endif
+
+#endif
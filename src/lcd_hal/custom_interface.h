@@ -121,6 +121,33 @@ public:
         }
     }
 
+    /**
+     * Sends the same byte to custom interface count times
+     * @param data - byte to send
+     * @param count - number of times to send the byte
+     */
+    void sendRepeat(uint8_t data, uint32_t count)
+    {
+        while ( count-- )
+        {
+            send(data);
+        }
+    }
+
+    /**
+     * Sends 16-bit value to custom interface count times, high byte first
+     * @param data - 16-bit value to send
+     * @param count - number of times to send the value
+     */
+    void sendRepeat16(uint16_t data, uint32_t count)
+    {
+        while ( count-- )
+        {
+            send(data >> 8);
+            send(data & 0xFF);
+        }
+    }
+
 protected:
     /**
      * This function must implement actual sending of data to hardware interface
@@ -204,4 +204,21 @@ void EspSpi::sendBuffer(const uint8_t *buffer, uint16_t size)
     }
 }
 
+void EspSpi::sendRepeat(uint8_t data, uint32_t count)
+{
+    while ( count-- )
+    {
+        send(data);
+    }
+}
+
+void EspSpi::sendRepeat16(uint16_t data, uint32_t count)
+{
+    while ( count-- )
+    {
+        send(data >> 8);
+        send(data & 0xFF);
+    }
+}
+
 #endif
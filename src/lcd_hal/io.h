@@ -78,6 +78,7 @@
 #elif defined(__linux__) || defined(__APPLE__)
 #include "linux/io.h"
 #ifdef __cplusplus
+#include "linux/linux_i2c_messages.h"
 #include "linux/linux_i2c.h"
 #include "linux/linux_spi.h"
 #include "linux/sdl_i2c.h"
@@ -674,6 +675,27 @@ public:
 #endif
 
 #include "custom_interface.h"
+#include "counting_bus.h"
+
+/**
+ * Ends current bus transaction and starts new one. Buses, implementing restart(),
+ * use I2C repeated start and may send both transactions in single transfer.
+ */
+template <class B> inline auto lcd_busRestart(B &bus, int) -> decltype(bus.restart())
+{
+    bus.restart();
+}
+
+/** Fallback for buses without restart(): stops and starts transaction */
+template <class B> inline void lcd_busRestart(B &bus, long)
+{
+    bus.stop();
+    bus.start();
+}
+
+#if ( defined(__linux__) || defined(__APPLE__) ) && !defined(ARDUINO)
+#include "linux/linux_async.h"
+#endif
 
 #endif
 
@@ -55,6 +55,14 @@ extern "C"
     int lcd_gfx_min(int a, int b);
     int lcd_gfx_max(int a, int b);
 
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+    /* While handler is registered, lcd_gpioWrite() passes new level of the pin to on_pin_write
+       instead of changing the pin. The handler changes the pin via lcd_gpioWriteDirect(). */
+    void lcd_registerGpioWriteHandler(int pin, void (*on_pin_write)(void *, int), void *arg);
+    void lcd_unregisterGpioWriteHandler(int pin);
+    void lcd_gpioWriteDirect(int pin, int level);
+#endif
+
     static inline char *utoa(unsigned int num, char *str, int radix)
     {
         char temp[17]; // an int can only be 16 bits long
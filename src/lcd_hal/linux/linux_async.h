@@ -0,0 +1,538 @@
+/*
+    MIT License
+
+    Copyright (c) 2024, Alexey Dynda
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+/*
+ * @file lcd_hal/linux/linux_async.h Asynchronous bus wrapper for Linux
+ */
+
+#ifndef _SSD1306V2_LINUX_LINUX_ASYNC_H_
+#define _SSD1306V2_LINUX_LINUX_ASYNC_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+/** Number of slots in the queue of asynchronous bus */
+#ifndef CONFIG_LINUX_ASYNC_QUEUE_SIZE
+#define CONFIG_LINUX_ASYNC_QUEUE_SIZE 256
+#endif
+
+/** Maximum number of data bytes in single slot of asynchronous bus queue */
+#ifndef CONFIG_LINUX_ASYNC_SLOT_SIZE
+#define CONFIG_LINUX_ASYNC_SLOT_SIZE 512
+#endif
+
+/**
+ * Statistics of asynchronous bus queue
+ */
+typedef struct
+{
+    /** Number of slots, waiting for transfer now */
+    uint32_t depth;
+    /** Maximum number of slots, waiting for transfer, since last reset */
+    uint32_t maxDepth;
+    /** Number of slots, passed to I/O thread */
+    uint32_t slots;
+    /** Number of times drawing thread waited for free slot */
+    uint32_t stalls;
+    /** Total time in microseconds, drawing thread waited for I/O thread */
+    uint32_t waitUs;
+} LinuxAsyncStats;
+
+/**
+ * Template class wraps bus implementation B and moves all transfers to dedicated I/O thread.
+ * Drawing thread puts commands and data to lock-free single-producer/single-consumer queue,
+ * and continues rendering, while I/O thread sends queued data to the bus. Threads lock
+ * the mutex only to sleep, when the queue is full or empty, and to wake up sleeping thread.
+ * Data are copied to the queue, so the caller can change its buffers (canvas) right after
+ * sendBuffer() returns.
+ *
+ * Asynchronous mode is disabled after begin(), since display initialization sequences
+ * rely on lcd_delay() between commands. Enable it via setAsync() after display begin():
+ * @code{.cpp}
+ * display.begin();
+ * display.getInterface().setAsync(true);
+ * @endcode
+ */
+template <class B> class LinuxAsyncBus
+{
+public:
+    /**
+     * Creates asynchronous wrapper for bus B
+     *
+     * @param syncPin pin, which must change its state in order with queued data (usually D/C pin),
+     *        -1 if not used. Writes to the pin are queued and performed by I/O thread. Before
+     *        the pin changes state B::stop() is called to push buffered data out, so B::stop()
+     *        must not end bus transaction in this case.
+     * @param args arguments to pass to bus B constructor
+     */
+    template <typename... Args>
+    explicit LinuxAsyncBus(int8_t syncPin, Args &&... args)
+        : m_bus(args...)
+        , m_syncPin(syncPin)
+    {
+    }
+
+    ~LinuxAsyncBus()
+    {
+        setAsync(false);
+    }
+
+    /**
+     * Initializes bus B
+     */
+    void begin()
+    {
+        m_bus.begin();
+        if ( m_syncPin >= 0 )
+        {
+            lcd_registerGpioWriteHandler(m_syncPin, onSyncPinWrite, this);
+        }
+    }
+
+    /**
+     * Sends all queued data, stops I/O thread and closes bus B
+     */
+    void end()
+    {
+        setAsync(false);
+        if ( m_syncPin >= 0 )
+        {
+            lcd_unregisterGpioWriteHandler(m_syncPin);
+        }
+        m_bus.end();
+    }
+
+    /**
+     * Enables or disables asynchronous mode. When asynchronous mode is disabled,
+     * all queued data are sent before the function returns.
+     *
+     * @param enable true to start I/O thread, false to stop it
+     */
+    void setAsync(bool enable)
+    {
+        if ( enable == m_async )
+        {
+            return;
+        }
+        if ( enable )
+        {
+            m_head.store(0, std::memory_order_relaxed);
+            m_tail.store(0, std::memory_order_relaxed);
+            m_running.store(true);
+            m_thread = std::thread(&LinuxAsyncBus<B>::run, this);
+            m_async = true;
+        }
+        else
+        {
+            waitIdle();
+            m_async = false;
+            m_running.store(false);
+            wake(m_ioSleeping, m_ready);
+            m_thread.join();
+        }
+    }
+
+    /**
+     * Returns true if asynchronous mode is enabled
+     */
+    bool isAsync() const
+    {
+        return m_async;
+    }
+
+    /**
+     * Waits until I/O thread sends all queued data to the bus
+     */
+    void waitIdle()
+    {
+        if ( !m_async )
+        {
+            return;
+        }
+        closeData();
+        if ( m_tail.load(std::memory_order_acquire) == m_head.load(std::memory_order_relaxed) )
+        {
+            return;
+        }
+        uint32_t ts = lcd_micros();
+        uint32_t head = m_head.load(std::memory_order_relaxed);
+        sleep(m_drawSleeping, m_consumed, [this, head]() { return m_tail.load() == head; });
+        m_stats.waitUs += lcd_micros() - ts;
+    }
+
+    /**
+     * Returns queue statistics
+     */
+    LinuxAsyncStats getStats()
+    {
+        m_stats.depth = depth();
+        return m_stats;
+    }
+
+    /**
+     * Resets queue statistics
+     */
+    void resetStats()
+    {
+        m_stats = LinuxAsyncStats();
+    }
+
+    /**
+     * Starts communication with the display
+     */
+    void start()
+    {
+        if ( m_async )
+            pushOp(OP_START);
+        else
+            m_bus.start();
+    }
+
+    /**
+     * Ends communication with the display
+     */
+    void stop()
+    {
+        if ( m_async )
+            pushOp(OP_STOP);
+        else
+            m_bus.stop();
+    }
+
+    /**
+     * Sends byte to the display
+     * @param data - byte to send
+     */
+    void send(uint8_t data)
+    {
+        if ( !m_async )
+        {
+            m_bus.send(data);
+            return;
+        }
+        Slot &slot = openData();
+        slot.data[slot.size++] = data;
+        if ( slot.size == sizeof(slot.data) )
+        {
+            closeData();
+        }
+    }
+
+    /**
+     * Sends bytes to the display. Bytes are copied to the queue.
+     * @param buffer - bytes to send
+     * @param size - number of bytes to send
+     */
+    void sendBuffer(const uint8_t *buffer, uint16_t size)
+    {
+        if ( !m_async )
+        {
+            m_bus.sendBuffer(buffer, size);
+            return;
+        }
+        while ( size )
+        {
+            Slot &slot = openData();
+            uint16_t len = sizeof(slot.data) - slot.size;
+            if ( len > size )
+            {
+                len = size;
+            }
+            memcpy(&slot.data[slot.size], buffer, len);
+            slot.size += len;
+            buffer += len;
+            size -= len;
+            if ( slot.size == sizeof(slot.data) )
+            {
+                closeData();
+            }
+        }
+    }
+
+    /**
+     * Sends the same byte to the display count times
+     * @param data - byte to send
+     * @param count - number of times to send the byte
+     */
+    void sendRepeat(uint8_t data, uint32_t count)
+    {
+        if ( !m_async )
+        {
+            m_bus.sendRepeat(data, count);
+            return;
+        }
+        Slot &slot = pushSlot(OP_REPEAT);
+        slot.value = data;
+        slot.count = count;
+        publish();
+    }
+
+    /**
+     * Sends 16-bit value to the display count times, high byte first
+     * @param data - 16-bit value to send
+     * @param count - number of times to send the value
+     */
+    void sendRepeat16(uint16_t data, uint32_t count)
+    {
+        if ( !m_async )
+        {
+            m_bus.sendRepeat16(data, count);
+            return;
+        }
+        Slot &slot = pushSlot(OP_REPEAT16);
+        slot.value = data;
+        slot.count = count;
+        publish();
+    }
+
+private:
+    enum
+    {
+        OP_START,
+        OP_STOP,
+        OP_DATA,
+        OP_REPEAT,
+        OP_REPEAT16,
+        OP_PIN,
+    };
+
+    typedef struct
+    {
+        uint8_t op;
+        uint16_t size;
+        uint16_t value;
+        uint32_t count;
+        uint8_t data[CONFIG_LINUX_ASYNC_SLOT_SIZE];
+    } Slot;
+
+    B m_bus;
+    int8_t m_syncPin;
+    bool m_async = false;
+    bool m_dataOpen = false;
+    Slot m_slots[CONFIG_LINUX_ASYNC_QUEUE_SIZE];
+    std::atomic<uint32_t> m_head{0}; ///< next slot to fill, changed by drawing thread only
+    std::atomic<uint32_t> m_tail{0}; ///< next slot to send, changed by I/O thread only
+    std::atomic<bool> m_running{false};
+    std::atomic<bool> m_ioSleeping{false};   ///< I/O thread sleeps on m_ready
+    std::atomic<bool> m_drawSleeping{false}; ///< drawing thread sleeps on m_consumed
+    std::mutex m_mutex;
+    std::condition_variable m_ready;
+    std::condition_variable m_consumed;
+    std::thread m_thread;
+    LinuxAsyncStats m_stats{};
+
+    static uint32_t nextIndex(uint32_t index)
+    {
+        return (index + 1) % CONFIG_LINUX_ASYNC_QUEUE_SIZE;
+    }
+
+    uint32_t depth() const
+    {
+        uint32_t head = m_head.load(std::memory_order_relaxed);
+        uint32_t tail = m_tail.load(std::memory_order_acquire);
+        return (head + CONFIG_LINUX_ASYNC_QUEUE_SIZE - tail) % CONFIG_LINUX_ASYNC_QUEUE_SIZE;
+    }
+
+    Slot &pushSlot(uint8_t op)
+    {
+        closeData();
+        uint32_t head = m_head.load(std::memory_order_relaxed);
+        if ( nextIndex(head) == m_tail.load(std::memory_order_acquire) )
+        {
+            uint32_t ts = lcd_micros();
+            m_stats.stalls++;
+            sleep(m_drawSleeping, m_consumed, [this, head]() { return nextIndex(head) != m_tail.load(); });
+            m_stats.waitUs += lcd_micros() - ts;
+        }
+        Slot &slot = m_slots[head];
+        slot.op = op;
+        slot.size = 0;
+        return slot;
+    }
+
+    /**
+     * Sleeps until done() returns true. The flag, set before done() is checked under the mutex,
+     * tells other thread to wake this one up, so the wakeup cannot be lost.
+     */
+    template <class P> void sleep(std::atomic<bool> &sleeping, std::condition_variable &cv, P done)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        sleeping.store(true);
+        cv.wait(lock, done);
+        sleeping.store(false);
+    }
+
+    /**
+     * Wakes up other thread, if it sleeps. Must be called after the state, checked by other
+     * thread, is changed.
+     */
+    void wake(std::atomic<bool> &sleeping, std::condition_variable &cv)
+    {
+        if ( sleeping.load() )
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            cv.notify_one();
+        }
+    }
+
+    void publish()
+    {
+        m_head.store(nextIndex(m_head.load(std::memory_order_relaxed)));
+        m_stats.slots++;
+        uint32_t queued = depth();
+        if ( queued > m_stats.maxDepth )
+        {
+            m_stats.maxDepth = queued;
+        }
+        wake(m_ioSleeping, m_ready);
+    }
+
+    void pushOp(uint8_t op)
+    {
+        pushSlot(op);
+        publish();
+    }
+
+    Slot &openData()
+    {
+        if ( !m_dataOpen )
+        {
+            pushSlot(OP_DATA);
+            m_dataOpen = true;
+        }
+        return m_slots[m_head.load(std::memory_order_relaxed)];
+    }
+
+    void closeData()
+    {
+        if ( m_dataOpen )
+        {
+            m_dataOpen = false;
+            publish();
+        }
+    }
+
+    void run()
+    {
+        for ( ;; )
+        {
+            uint32_t tail = m_tail.load(std::memory_order_relaxed);
+            if ( tail == m_head.load(std::memory_order_acquire) )
+            {
+                if ( !m_running.load() )
+                {
+                    break;
+                }
+                sleep(m_ioSleeping, m_ready, [this, tail]() { return m_head.load() != tail || !m_running.load(); });
+                continue;
+            }
+            Slot &slot = m_slots[tail];
+            switch ( slot.op )
+            {
+                case OP_START: m_bus.start(); break;
+                case OP_STOP: m_bus.stop(); break;
+                case OP_DATA: m_bus.sendBuffer(slot.data, slot.size); break;
+                case OP_REPEAT: m_bus.sendRepeat(slot.value, slot.count); break;
+                case OP_REPEAT16: m_bus.sendRepeat16(slot.value, slot.count); break;
+                case OP_PIN: writeSyncPin(slot.value); break;
+                default: break;
+            }
+            m_tail.store(nextIndex(tail));
+            wake(m_drawSleeping, m_consumed);
+        }
+    }
+
+    void writeSyncPin(int level)
+    {
+        m_bus.stop();
+        lcd_gpioWriteDirect(m_syncPin, level);
+    }
+
+    static void onSyncPinWrite(void *arg, int level)
+    {
+        LinuxAsyncBus<B> *obj = reinterpret_cast<LinuxAsyncBus<B> *>(arg);
+        if ( obj->m_async )
+        {
+            Slot &slot = obj->pushSlot(OP_PIN);
+            slot.value = level;
+            obj->publish();
+        }
+        else
+        {
+            obj->writeSyncPin(level);
+        }
+    }
+};
+
+#if defined(CONFIG_LINUX_SPI_AVAILABLE) && defined(CONFIG_LINUX_SPI_ENABLE) && !defined(SDL_EMULATION)
+
+/**
+ * Asynchronous spi bus for linux via spidev interface.
+ * It has the same constructor parameters as LinuxSpi.
+ */
+class LinuxAsyncSpi: public LinuxAsyncBus<LinuxSpi>
+{
+public:
+    /**
+     * Creates instance of asynchronous spi bus
+     *
+     * @param busId spi bus to use as first number for spidev
+     * @param devId spi device number to use as second number for spidev
+     * @param dcPin pin to use as data/command mode pin
+     * @param frequency frequency to run SPI bus on
+     */
+    LinuxAsyncSpi(int busId, int8_t devId, int8_t dcPin, uint32_t frequency)
+        : LinuxAsyncBus<LinuxSpi>(dcPin, busId, devId, -1, frequency)
+    {
+    }
+};
+
+#endif
+
+#if defined(CONFIG_LINUX_I2C_AVAILABLE) && defined(CONFIG_LINUX_I2C_ENABLE) && !defined(SDL_EMULATION)
+
+/**
+ * Asynchronous i2c bus for linux via i2c-dev interface.
+ * It has the same constructor parameters as LinuxI2c.
+ */
+class LinuxAsyncI2c: public LinuxAsyncBus<LinuxI2c>
+{
+public:
+    /**
+     * Creates instance of asynchronous i2c bus
+     *
+     * @param busId i2c bus number, if -1 defaults to 1
+     * @param sa i2c address of the display (7 bits)
+     */
+    explicit LinuxAsyncI2c(int8_t busId = -1, uint8_t sa = 0x00)
+        : LinuxAsyncBus<LinuxI2c>(-1, busId, sa)
+    {
+    }
+};
+
+#endif
+
+#endif
@@ -35,6 +35,7 @@
 #include <unistd.h>
 #include <sys/ioctl.h>
 #if defined(__linux__)
+#include <linux/i2c.h>
 #include <linux/i2c-dev.h>
 #include <linux/spi/spidev.h>
 #endif
@@ -49,9 +50,14 @@
 //////////////////////////////////////////////////////////////////////////////////
 #if defined(CONFIG_LINUX_I2C_AVAILABLE) && defined(CONFIG_LINUX_I2C_ENABLE) && !defined(SDL_EMULATION)
 
+#if defined(I2C_M_NOSTART)
+static_assert(LinuxI2cMessages::FLAG_NOSTART == I2C_M_NOSTART, "message flags are passed to i2c-dev as is");
+#endif
+
 LinuxI2c::LinuxI2c(int8_t busId, uint8_t sa)
     : m_busId(busId)
     , m_sa(sa)
+    , m_messages(OnFlush, this)
 {
 }
 
@@ -82,6 +88,15 @@ void LinuxI2c::begin()
         fprintf(stderr, "Failed to acquire bus access and/or talk to slave.\n");
         return;
     }
+#if defined(I2C_RDWR)
+    unsigned long funcs = 0;
+    if ( ioctl(m_fd, I2C_FUNCS, &funcs) == 0 )
+    {
+        /* SMBus-only adapters support plain write() only */
+        m_rdwr = (funcs & I2C_FUNC_I2C) != 0;
+        m_messages.setNoStart(m_rdwr && (funcs & I2C_FUNC_NOSTART) != 0);
+    }
+#endif
 }
 
 void LinuxI2c::end()
@@ -95,39 +110,68 @@ void LinuxI2c::end()
 
 void LinuxI2c::start()
 {
-    m_dataSize = 0;
+    m_messages.start();
+}
+
+void LinuxI2c::restart()
+{
+    m_messages.restart();
 }
 
 void LinuxI2c::stop()
 {
-    if ( write(m_fd, m_buffer, m_dataSize) != m_dataSize )
+    m_messages.stop();
+}
+
+void LinuxI2c::OnFlush(void *arg, const LinuxI2cMessages::I2cSegment *segments, uint8_t count)
+{
+    LinuxI2c *obj = reinterpret_cast<LinuxI2c *>(arg);
+#if defined(I2C_RDWR)
+    if ( obj->m_rdwr )
     {
-        fprintf(stderr, "Failed to write to the i2c bus: %s.\n", strerror(errno));
+        struct i2c_msg msgs[LinuxI2cMessages::MAX_SEGMENTS];
+        for ( uint8_t i = 0; i < count; i++ )
+        {
+            msgs[i].addr = obj->m_sa;
+            msgs[i].flags = segments[i].flags;
+            msgs[i].len = segments[i].size;
+            msgs[i].buf = const_cast<uint8_t *>(segments[i].data);
+        }
+        struct i2c_rdwr_ioctl_data request = {msgs, count};
+        if ( ioctl(obj->m_fd, I2C_RDWR, &request) < 0 )
+        {
+            fprintf(stderr, "Failed to write to the i2c bus: %s.\n", strerror(errno));
+        }
+        return;
+    }
+#endif
+    for ( uint8_t i = 0; i < count; i++ )
+    {
+        if ( write(obj->m_fd, segments[i].data, segments[i].size) != segments[i].size )
+        {
+            fprintf(stderr, "Failed to write to the i2c bus: %s.\n", strerror(errno));
+        }
     }
-    m_dataSize = 0;
 }
 
 void LinuxI2c::send(uint8_t data)
 {
-    m_buffer[m_dataSize] = data;
-    m_dataSize++;
-    if ( m_dataSize == sizeof(m_buffer) )
-    {
-        /* Send function puts all data to internal buffer.  *
-         * Restart transmission if internal buffer is full. */
-        stop();
-        start();
-        send(0x40);
-    }
+    m_messages.send(data);
 }
 
 void LinuxI2c::sendBuffer(const uint8_t *buffer, uint16_t size)
 {
-    while ( size-- )
-    {
-        send(*buffer);
-        buffer++;
-    }
+    m_messages.sendBuffer(buffer, size);
+}
+
+void LinuxI2c::sendRepeat(uint8_t data, uint32_t count)
+{
+    m_messages.sendRepeat(data, count);
+}
+
+void LinuxI2c::sendRepeat16(uint16_t data, uint32_t count)
+{
+    m_messages.sendRepeat16(data, count);
 }
 
 #endif
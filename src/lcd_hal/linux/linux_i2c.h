@@ -63,9 +63,16 @@ public:
 
     /**
      * Ends communication with SSD1306 display.
+     * All transactions, collected since start(), are sent in single I2C_RDWR request.
      */
     void stop();
 
+    /**
+     * Ends current transaction and starts new one with repeated start condition.
+     * Both transactions are sent to the device by single stop() call.
+     */
+    void restart();
+
     /**
      * Sends byte to SSD1306 device
      * @param data - byte to send
@@ -75,14 +82,34 @@ public:
     /**
      * @brief Sends bytes to SSD1306 device
      *
-     * Sends bytes to SSD1306 device. This functions gives
-     * ~ 30% performance increase than ssd1306_intf.send.
+     * Sends bytes to SSD1306 device. If i2c adapter supports I2C_M_NOSTART messages,
+     * large buffers are passed to i2c-dev directly without copying. In the last case
+     * all pending data are sent before the function returns, so the caller can reuse
+     * the buffer right after the call.
      *
      * @param buffer - bytes to send
      * @param size - number of bytes to send
      */
     void sendBuffer(const uint8_t *buffer, uint16_t size);
 
+    /**
+     * Sends the same byte to the device count times.
+     * Display operations use it to fill areas with a single color.
+     *
+     * @param data - byte to send
+     * @param count - number of times to send the byte
+     */
+    void sendRepeat(uint8_t data, uint32_t count);
+
+    /**
+     * Sends 16-bit value to the device count times, high byte first.
+     * Display operations use it to fill areas with a single 16-bit color.
+     *
+     * @param data - 16-bit value to send
+     * @param count - number of times to send the value
+     */
+    void sendRepeat16(uint16_t data, uint32_t count);
+
     /**
      * Sets i2c address for communication
      * This API is required for some led displays having multiple
@@ -95,12 +122,34 @@ public:
         m_sa = addr;
     }
 
+    /**
+     * Returns maximum length of single i2c message. Longer transactions are split
+     * to several messages, each starting with the control byte of the transaction.
+     */
+    uint16_t getMaxMessageSize() const
+    {
+        return m_messages.getMaxMessageSize();
+    }
+
+    /**
+     * Sets maximum length of single i2c message. Some i2c adapters reject long messages,
+     * and Linux doesn't report this limit to user space, so it should be set by application.
+     *
+     * @param size maximum message length in bytes, 4 - 8192
+     */
+    void setMaxMessageSize(uint16_t size)
+    {
+        m_messages.setMaxMessageSize(size);
+    }
+
 private:
     int8_t m_busId;
     uint8_t m_sa;
     int m_fd = -1;
-    uint16_t m_dataSize = 0;
-    uint8_t m_buffer[1024]{};
+    bool m_rdwr = false;
+    LinuxI2cMessages m_messages;
+
+    static void OnFlush(void *arg, const LinuxI2cMessages::I2cSegment *segments, uint8_t count);
 };
 
 #endif
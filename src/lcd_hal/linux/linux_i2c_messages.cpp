@@ -0,0 +1,257 @@
+/*
+    MIT License
+
+    Copyright (c) 2018-2019, Alexey Dynda
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#if ( defined(__linux__) || defined(__APPLE__) ) && !defined(ARDUINO)
+
+#include "../io.h"
+
+#include <string.h>
+
+#if defined(CONFIG_LINUX_I2C_AVAILABLE) && defined(CONFIG_LINUX_I2C_ENABLE)
+
+LinuxI2cMessages::LinuxI2cMessages(void (*onFlush)(void *arg, const I2cSegment *segments, uint8_t count), void *arg)
+    : m_onFlush(onFlush)
+    , m_arg(arg)
+{
+}
+
+void LinuxI2cMessages::setMaxMessageSize(uint16_t size)
+{
+    /* i2c-dev rejects messages longer than 8192 bytes */
+    if ( size > 8192 )
+    {
+        size = 8192;
+    }
+    if ( size < 4 )
+    {
+        size = 4;
+    }
+    m_maxMessageSize = size;
+}
+
+void LinuxI2cMessages::start()
+{
+    m_newMessage = true;
+}
+
+void LinuxI2cMessages::restart()
+{
+    m_newMessage = true;
+}
+
+void LinuxI2cMessages::stop()
+{
+    sendSegments();
+    m_newMessage = true;
+}
+
+void LinuxI2cMessages::addSegment(const uint8_t *data, uint16_t size, uint16_t flags)
+{
+    if ( m_newMessage )
+    {
+        m_newMessage = false;
+        m_messageSize = 0;
+        flags = 0;
+    }
+    else if ( m_segmentCount > 0 )
+    {
+        I2cSegment &last = m_segments[m_segmentCount - 1];
+        if ( last.data + last.size == data )
+        {
+            last.size += size;
+            m_messageSize += size;
+            return;
+        }
+    }
+    m_segments[m_segmentCount].data = data;
+    m_segments[m_segmentCount].size = size;
+    m_segments[m_segmentCount].flags = flags;
+    m_segmentCount++;
+    m_messageSize += size;
+}
+
+void LinuxI2cMessages::splitMessage(uint16_t size)
+{
+    /* Device expects control byte at the beginning of each message. *
+     * One segment is reserved for the data, following the byte.     */
+    m_newMessage = true;
+    if ( (size_t)m_dataSize + size + 1 > sizeof(m_buffer) || m_segmentCount >= MAX_SEGMENTS - 1 )
+    {
+        sendSegments();
+    }
+    m_buffer[m_dataSize] = m_control;
+    addSegment(&m_buffer[m_dataSize], 1, 0);
+    m_dataSize++;
+}
+
+void LinuxI2cMessages::sendSegments()
+{
+    if ( m_segmentCount == 0 )
+    {
+        return;
+    }
+    m_onFlush(m_arg, m_segments, m_segmentCount);
+    m_segmentCount = 0;
+    m_dataSize = 0;
+}
+
+uint16_t LinuxI2cMessages::chunkSize() const
+{
+    uint16_t len = m_maxMessageSize - 1 < ZERO_COPY_SIZE ? m_maxMessageSize - 1 : ZERO_COPY_SIZE;
+    if ( !m_newMessage )
+    {
+        /* Fill current message up to the end before splitting it */
+        uint16_t room = m_maxMessageSize - m_messageSize;
+        if ( sizeof(m_buffer) - m_dataSize < room )
+        {
+            room = sizeof(m_buffer) - m_dataSize;
+        }
+        if ( room > 0 && room < len )
+        {
+            len = room;
+        }
+    }
+    return len;
+}
+
+uint8_t *LinuxI2cMessages::allocCache(uint16_t size)
+{
+    if ( m_newMessage )
+    {
+        if ( (size_t)m_dataSize + size > sizeof(m_buffer) || m_segmentCount == MAX_SEGMENTS )
+        {
+            sendSegments();
+        }
+    }
+    else if ( m_messageSize + size > m_maxMessageSize || (size_t)m_dataSize + size > sizeof(m_buffer) ||
+              m_segmentCount == MAX_SEGMENTS )
+    {
+        splitMessage(size);
+    }
+    uint8_t *ptr = &m_buffer[m_dataSize];
+    m_dataSize += size;
+    addSegment(ptr, size, FLAG_NOSTART);
+    return ptr;
+}
+
+void LinuxI2cMessages::send(uint8_t data)
+{
+    if ( m_newMessage )
+    {
+        m_control = data;
+    }
+    *allocCache(1) = data;
+}
+
+void LinuxI2cMessages::sendBuffer(const uint8_t *buffer, uint16_t size)
+{
+    if ( size && m_newMessage )
+    {
+        m_control = buffer[0];
+    }
+    if ( size < ZERO_COPY_SIZE || !m_noStart || m_newMessage )
+    {
+        while ( size )
+        {
+            uint16_t len = chunkSize();
+            if ( len > size )
+            {
+                len = size;
+            }
+            memcpy(allocCache(len), buffer, len);
+            buffer += len;
+            size -= len;
+        }
+        return;
+    }
+    /* Payload continues the message in place, without start condition and address */
+    while ( size )
+    {
+        if ( m_messageSize >= m_maxMessageSize || m_segmentCount >= MAX_SEGMENTS )
+        {
+            splitMessage(0);
+        }
+        uint16_t len = m_maxMessageSize - m_messageSize;
+        if ( len > size )
+        {
+            len = size;
+        }
+        addSegment(buffer, len, FLAG_NOSTART);
+        buffer += len;
+        size -= len;
+    }
+    /* The buffer belongs to the caller, it can be changed after return, *
+     * so the rest of transaction will go in new message.               */
+    sendSegments();
+    m_messageSize = m_maxMessageSize;
+}
+
+void LinuxI2cMessages::sendRepeat(uint8_t data, uint32_t count)
+{
+    if ( count && m_newMessage )
+    {
+        m_control = data;
+    }
+    while ( count )
+    {
+        uint16_t len = chunkSize();
+        if ( len > count )
+        {
+            len = count;
+        }
+        memset(allocCache(len), data, len);
+        count -= len;
+    }
+}
+
+void LinuxI2cMessages::sendRepeat16(uint16_t data, uint32_t count)
+{
+    if ( count && m_newMessage )
+    {
+        m_control = data >> 8;
+    }
+    while ( count )
+    {
+        uint16_t len = chunkSize() / 2;
+        if ( len == 0 )
+        {
+            len = 1;
+        }
+        if ( len > count )
+        {
+            len = count;
+        }
+        uint8_t *ptr = allocCache(len * 2);
+        for ( uint16_t i = 0; i < len; i++ )
+        {
+            *ptr++ = data >> 8;
+            *ptr++ = data & 0xFF;
+        }
+        count -= len;
+    }
+}
+
+#endif
+
+#endif // __linux__
@@ -0,0 +1,155 @@
+/*
+    MIT License
+
+    Copyright (c) 2026, Alexey Dynda
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+/*
+ * @file lcd_hal/linux/linux_i2c_messages.h Builder of i2c messages for LinuxI2c
+ */
+
+#ifndef _SSD1306V2_LINUX_LINUX_I2C_MESSAGES_H_
+#define _SSD1306V2_LINUX_LINUX_I2C_MESSAGES_H_
+
+#if defined(CONFIG_LINUX_I2C_AVAILABLE) && defined(CONFIG_LINUX_I2C_ENABLE)
+
+#include <stdint.h>
+
+/**
+ * Class splits bus transactions to i2c messages for single I2C_RDWR request.
+ * Each transaction starts new message. Transactions, longer than maximum message size,
+ * are split to several messages, each starting with the first (control) byte of the transaction.
+ * Collected messages are passed to the flush callback, which sends them to the device.
+ */
+class LinuxI2cMessages
+{
+public:
+    /** Maximum number of i2c messages in single I2C_RDWR request */
+    static const uint8_t MAX_SEGMENTS = 42;
+    /** Buffers of this size and larger are sent without copying to the cache */
+    static const uint16_t ZERO_COPY_SIZE = 64;
+    /** Message flag: message continues previous one without start condition (I2C_M_NOSTART) */
+    static const uint16_t FLAG_NOSTART = 0x4000;
+
+    /** Describes single i2c message, either in the cache or in the user buffer */
+    typedef struct
+    {
+        const uint8_t *data;
+        uint16_t size;
+        uint16_t flags;
+    } I2cSegment;
+
+    /**
+     * Creates message builder
+     *
+     * @param onFlush callback, which sends collected messages to the device
+     * @param arg argument to pass to the callback
+     */
+    LinuxI2cMessages(void (*onFlush)(void *arg, const I2cSegment *segments, uint8_t count), void *arg);
+
+    /**
+     * Enables sending of large buffers without copying as FLAG_NOSTART messages.
+     *
+     * @param enable true if i2c adapter supports I2C_M_NOSTART messages
+     */
+    void setNoStart(bool enable)
+    {
+        m_noStart = enable;
+    }
+
+    /**
+     * Returns maximum length of single i2c message.
+     */
+    uint16_t getMaxMessageSize() const
+    {
+        return m_maxMessageSize;
+    }
+
+    /**
+     * Sets maximum length of single i2c message.
+     *
+     * @param size maximum message length in bytes, 4 - 8192
+     */
+    void setMaxMessageSize(uint16_t size);
+
+    /** Starts new transaction */
+    void start();
+
+    /** Ends current transaction and starts new one in the same I2C_RDWR request */
+    void restart();
+
+    /** Ends current transaction and passes all collected messages to the flush callback */
+    void stop();
+
+    /**
+     * Adds byte to current transaction
+     * @param data - byte to send
+     */
+    void send(uint8_t data);
+
+    /**
+     * Adds bytes to current transaction. Large buffers are passed to the flush callback
+     * before the function returns, so the caller can reuse the buffer right after the call.
+     *
+     * @param buffer - bytes to send
+     * @param size - number of bytes to send
+     */
+    void sendBuffer(const uint8_t *buffer, uint16_t size);
+
+    /**
+     * Adds the same byte to current transaction count times.
+     *
+     * @param data - byte to send
+     * @param count - number of times to send the byte
+     */
+    void sendRepeat(uint8_t data, uint32_t count);
+
+    /**
+     * Adds 16-bit value to current transaction count times, high byte first.
+     *
+     * @param data - 16-bit value to send
+     * @param count - number of times to send the value
+     */
+    void sendRepeat16(uint16_t data, uint32_t count);
+
+private:
+    void (*m_onFlush)(void *arg, const I2cSegment *segments, uint8_t count);
+    void *m_arg;
+    bool m_noStart = false;
+    bool m_newMessage = true;
+    uint8_t m_control = 0;
+    uint16_t m_maxMessageSize = 4096;
+    uint16_t m_messageSize = 0;
+    uint16_t m_dataSize = 0;
+    uint8_t m_segmentCount = 0;
+    I2cSegment m_segments[MAX_SEGMENTS]{};
+    uint8_t m_buffer[4096]{};
+
+    uint16_t chunkSize() const;
+    uint8_t *allocCache(uint16_t size);
+    void addSegment(const uint8_t *data, uint16_t size, uint16_t flags);
+    void splitMessage(uint16_t size);
+    void sendSegments();
+};
+
+#endif
+
+#endif
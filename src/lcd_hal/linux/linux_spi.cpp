@@ -96,6 +96,17 @@ void LinuxSpi::begin()
     {
         printf("Failed to set SPI BPW: %s!\n", strerror(errno));
     }
+    /* spidev rejects messages larger than its bufsiz parameter */
+    FILE *f = fopen("/sys/module/spidev/parameters/bufsiz", "r");
+    if ( f )
+    {
+        unsigned int bufsiz = 0;
+        if ( fscanf(f, "%u", &bufsiz) == 1 && bufsiz >= ZERO_COPY_SIZE )
+        {
+            m_maxMessageSize = bufsiz;
+        }
+        fclose(f);
+    }
     // THIS IS HACK TO GET NOTIFICATIONS ON DC PIN CHANGE
     lcd_registerGpioEvent(m_dc, OnDcChange, this);
 }
@@ -113,60 +124,130 @@ void LinuxSpi::end()
 void LinuxSpi::start()
 {
     m_spi_cached_count = 0;
+    m_segmentCount = 0;
+    m_pendingSize = 0;
 }
 
 void LinuxSpi::stop()
 {
-    sendCache();
+    sendSegments();
 }
 
 void LinuxSpi::OnDcChange(void *arg)
 {
+    /* D/C line cannot change inside single spidev message, *
+     * so everything collected before the change is sent now */
     LinuxSpi *obj = reinterpret_cast<LinuxSpi *>(arg);
-    obj->sendCache();
+    obj->sendSegments();
 }
 
-void LinuxSpi::sendCache()
+void LinuxSpi::sendSegments()
 {
-    /* TODO: Yeah, sending single bytes is too slow, but *
-     * need to figure out how to detect data/command bytes *
-     * to send bytes as one block */
-    if ( m_spi_cached_count == 0 )
+    if ( m_segmentCount == 0 )
     {
         return;
     }
-    struct spi_ioc_transfer mesg;
-    memset(&mesg, 0, sizeof mesg);
-    mesg.tx_buf = (unsigned long)&m_spi_cache[0];
-    mesg.rx_buf = 0;
-    mesg.len = m_spi_cached_count;
-    mesg.delay_usecs = 0;
-    mesg.speed_hz = 0;
-    mesg.bits_per_word = 8;
-    mesg.cs_change = 0;
-    if ( ioctl(m_spi_fd, SPI_IOC_MESSAGE(1), &mesg) < 1 )
+    struct spi_ioc_transfer mesg[MAX_SEGMENTS];
+    memset(mesg, 0, sizeof(mesg[0]) * m_segmentCount);
+    for ( uint8_t i = 0; i < m_segmentCount; i++ )
+    {
+        mesg[i].tx_buf = (unsigned long)m_segments[i].data;
+        mesg[i].len = m_segments[i].size;
+        mesg[i].bits_per_word = 8;
+    }
+    /* Same as SPI_IOC_MESSAGE(), which cannot be used with non-constant number of transfers */
+    if ( ioctl(m_spi_fd, _IOC(_IOC_WRITE, SPI_IOC_MAGIC, 0, SPI_MSGSIZE(m_segmentCount)), mesg) < 1 )
     {
         fprintf(stderr, "SPI failed to send SPI message: %s\n", strerror(errno));
     }
+    m_segmentCount = 0;
+    m_pendingSize = 0;
     m_spi_cached_count = 0;
 }
 
-void LinuxSpi::send(uint8_t data)
+void LinuxSpi::addSegment(const uint8_t *data, uint32_t size)
+{
+    m_pendingSize += size;
+    if ( m_segmentCount > 0 )
+    {
+        SpiSegment &last = m_segments[m_segmentCount - 1];
+        if ( last.data + last.size == data )
+        {
+            last.size += size;
+            return;
+        }
+    }
+    m_segments[m_segmentCount].data = data;
+    m_segments[m_segmentCount].size = size;
+    m_segmentCount++;
+}
+
+uint8_t *LinuxSpi::allocCache(uint16_t size)
 {
-    m_spi_cache[m_spi_cached_count] = data;
-    m_spi_cached_count++;
-    if ( m_spi_cached_count >= sizeof(m_spi_cache) )
+    if ( m_spi_cached_count + size > sizeof(m_spi_cache) || m_pendingSize + size > m_maxMessageSize ||
+         m_segmentCount == MAX_SEGMENTS )
     {
-        sendCache();
+        sendSegments();
     }
+    uint8_t *ptr = &m_spi_cache[m_spi_cached_count];
+    m_spi_cached_count += size;
+    addSegment(ptr, size);
+    return ptr;
+}
+
+void LinuxSpi::send(uint8_t data)
+{
+    *allocCache(1) = data;
 }
 
 void LinuxSpi::sendBuffer(const uint8_t *buffer, uint16_t size)
 {
-    while ( size-- )
+    if ( size < ZERO_COPY_SIZE )
+    {
+        memcpy(allocCache(size), buffer, size);
+        return;
+    }
+    while ( size )
+    {
+        if ( m_pendingSize >= m_maxMessageSize || m_segmentCount == MAX_SEGMENTS )
+        {
+            sendSegments();
+        }
+        uint32_t len = m_maxMessageSize - m_pendingSize;
+        if ( len > size )
+        {
+            len = size;
+        }
+        addSegment(buffer, len);
+        buffer += len;
+        size -= len;
+    }
+    /* The buffer belongs to the caller, it can be changed after return */
+    sendSegments();
+}
+
+void LinuxSpi::sendRepeat(uint8_t data, uint32_t count)
+{
+    while ( count )
+    {
+        uint16_t len = count > ZERO_COPY_SIZE ? ZERO_COPY_SIZE : count;
+        memset(allocCache(len), data, len);
+        count -= len;
+    }
+}
+
+void LinuxSpi::sendRepeat16(uint16_t data, uint32_t count)
+{
+    while ( count )
     {
-        send(*buffer);
-        buffer++;
+        uint16_t len = count > (ZERO_COPY_SIZE / 2) ? (ZERO_COPY_SIZE / 2) : count;
+        uint8_t *ptr = allocCache(len * 2);
+        for ( uint16_t i = 0; i < len; i++ )
+        {
+            *ptr++ = data >> 8;
+            *ptr++ = data & 0xFF;
+        }
+        count -= len;
     }
 }
 
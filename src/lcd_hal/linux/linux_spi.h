@@ -78,24 +78,62 @@ public:
     /**
      * @brief Sends bytes to SSD1306 device
      *
-     * Sends bytes to SSD1306 device. This functions gives
-     * ~ 30% performance increase than ssd1306_intf.send.
+     * Sends bytes to SSD1306 device. Short buffers are copied to internal
+     * cache, large buffers are passed to spidev directly without copying.
+     * In the last case all pending data are sent before the function returns,
+     * so the caller can reuse the buffer right after the call.
      *
      * @param buffer - bytes to send
      * @param size - number of bytes to send
      */
     void sendBuffer(const uint8_t *buffer, uint16_t size);
 
+    /**
+     * Sends the same byte to the device count times.
+     * Display operations use it to fill areas with a single color.
+     *
+     * @param data - byte to send
+     * @param count - number of times to send the byte
+     */
+    void sendRepeat(uint8_t data, uint32_t count);
+
+    /**
+     * Sends 16-bit value to the device count times, high byte first.
+     * Display operations use it to fill areas with a single 16-bit color.
+     *
+     * @param data - 16-bit value to send
+     * @param count - number of times to send the value
+     */
+    void sendRepeat16(uint16_t data, uint32_t count);
+
 private:
+    /** Maximum number of spi transfers in single SPI_IOC_MESSAGE request */
+    static const uint8_t MAX_SEGMENTS = 16;
+    /** Buffers of this size and larger are sent without copying to the cache */
+    static const uint16_t ZERO_COPY_SIZE = 64;
+
+    /** Describes single block of data to send, either in the cache or in the user buffer */
+    typedef struct
+    {
+        const uint8_t *data;
+        uint32_t size;
+    } SpiSegment;
+
     int m_busId;
     int8_t m_devId;
     int8_t m_dc;
     uint32_t m_frequency;
+    uint32_t m_maxMessageSize = 4096;
+    uint32_t m_pendingSize = 0;
+    uint8_t m_segmentCount = 0;
+    SpiSegment m_segments[MAX_SEGMENTS]{};
     uint16_t m_spi_cached_count;
-    uint8_t m_spi_cache[1024]{};
+    uint8_t m_spi_cache[4096]{};
     int m_spi_fd = -1;
 
-    void sendCache();
+    uint8_t *allocCache(uint16_t size);
+    void addSegment(const uint8_t *data, uint32_t size);
+    void sendSegments();
     static void OnDcChange(void *arg);
 };
 
@@ -358,11 +358,18 @@ typedef struct
 } SPinEvent;
 #endif
 
+typedef struct
+{
+    void (*on_pin_write)(void *, int);
+    void *arg;
+} SPinWriteHandler;
+
 static uint8_t s_exported_pin[MAX_GPIO_COUNT] = {0};
 static uint8_t s_pin_mode[MAX_GPIO_COUNT] = {0};
 #ifdef LINUX_SPI_AVAILABLE
 std::map<int, SPinEvent> s_events;
 #endif
+static std::map<int, SPinWriteHandler> s_writeHandlers;
 
 void lcd_gpioMode(int pin, int mode)
 {
@@ -388,13 +395,23 @@ void lcd_gpioMode(int pin, int mode)
 
 void lcd_gpioWrite(int pin, int level)
 {
+    auto handler = s_writeHandlers.find(pin);
+    if ( handler != s_writeHandlers.end() )
+    {
+        handler->second.on_pin_write(handler->second.arg, level);
+        return;
+    }
 #ifdef LINUX_SPI_AVAILABLE
     if ( s_events.find(pin) != s_events.end() )
     {
         s_events[pin].on_pin_change(s_events[pin].arg);
     }
 #endif
+    lcd_gpioWriteDirect(pin, level);
+}
 
+void lcd_gpioWriteDirect(int pin, int level)
+{
     if ( !s_exported_pin[pin] )
     {
         if ( gpio_export(pin) < 0 )
@@ -423,6 +440,17 @@ void lcd_unregisterGpioEvent(int pin)
     s_events.erase(pin);
 }
 
+void lcd_registerGpioWriteHandler(int pin, void (*on_pin_write)(void *, int), void *arg)
+{
+    s_writeHandlers[pin].arg = arg;
+    s_writeHandlers[pin].on_pin_write = on_pin_write;
+}
+
+void lcd_unregisterGpioWriteHandler(int pin)
+{
+    s_writeHandlers.erase(pin);
+}
+
 int lcd_gpioRead(int pin)
 {
     return gpio_read(pin) ? LCD_HIGH : LCD_LOW;
@@ -469,6 +497,21 @@ int lcd_gfx_max(int a, int b)
 
 #else // SDL_EMULATION
 
+typedef struct
+{
+    void (*on_pin_change)(void *);
+    void *arg;
+} SPinEvent;
+
+typedef struct
+{
+    void (*on_pin_write)(void *, int);
+    void *arg;
+} SPinWriteHandler;
+
+static std::map<int, SPinEvent> s_events;
+static std::map<int, SPinWriteHandler> s_writeHandlers;
+
 int lcd_gpioRead(int pin)
 {
     return sdl_read_digital(pin);
@@ -480,10 +523,47 @@ int lcd_adcRead(int pin)
 }
 
 void lcd_gpioWrite(int pin, int level)
+{
+    auto handler = s_writeHandlers.find(pin);
+    if ( handler != s_writeHandlers.end() )
+    {
+        handler->second.on_pin_write(handler->second.arg, level);
+        return;
+    }
+    if ( s_events.find(pin) != s_events.end() )
+    {
+        s_events[pin].on_pin_change(s_events[pin].arg);
+    }
+    sdl_write_digital(pin, level);
+}
+
+void lcd_gpioWriteDirect(int pin, int level)
 {
     sdl_write_digital(pin, level);
 }
 
+void lcd_registerGpioEvent(int pin, void (*on_pin_change)(void *), void *arg)
+{
+    s_events[pin].arg = arg;
+    s_events[pin].on_pin_change = on_pin_change;
+}
+
+void lcd_unregisterGpioEvent(int pin)
+{
+    s_events.erase(pin);
+}
+
+void lcd_registerGpioWriteHandler(int pin, void (*on_pin_write)(void *, int), void *arg)
+{
+    s_writeHandlers[pin].arg = arg;
+    s_writeHandlers[pin].on_pin_write = on_pin_write;
+}
+
+void lcd_unregisterGpioWriteHandler(int pin)
+{
+    s_writeHandlers.erase(pin);
+}
+
 void lcd_gpioMode(int pin, int mode)
 {
     // TODO: Not implemented
@@ -491,6 +571,8 @@ void lcd_gpioMode(int pin, int mode)
 
 void lcd_delay(unsigned long ms)
 {
+    /* Show screen updates, delayed by emulator refresh rate limit */
+    sdl_core_draw();
     usleep(ms * 1000);
 }
 
@@ -90,6 +90,23 @@ void SdlI2c::sendBuffer(const uint8_t *buffer, uint16_t size)
     }
 }
 
+void SdlI2c::sendRepeat(uint8_t data, uint32_t count)
+{
+    while ( count-- )
+    {
+        send(data);
+    }
+}
+
+void SdlI2c::sendRepeat16(uint16_t data, uint32_t count)
+{
+    while ( count-- )
+    {
+        send(data >> 8);
+        send(data & 0xFF);
+    }
+}
+
 #endif
 
 #endif // __linux__
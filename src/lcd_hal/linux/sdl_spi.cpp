@@ -93,6 +93,23 @@ void SdlSpi::sendBuffer(const uint8_t *buffer, uint16_t size)
     }
 }
 
+void SdlSpi::sendRepeat(uint8_t data, uint32_t count)
+{
+    while ( count-- )
+    {
+        send(data);
+    }
+}
+
+void SdlSpi::sendRepeat16(uint16_t data, uint32_t count)
+{
+    while ( count-- )
+    {
+        send(data >> 8);
+        send(data & 0xFF);
+    }
+}
+
 #endif /* SDL_EMULATION */
 
 #endif // __linux__
@@ -74,5 +74,22 @@ void PicoI2c::sendBuffer(const uint8_t *buffer, uint16_t size)
 {
 }
 
+void PicoI2c::sendRepeat(uint8_t data, uint32_t count)
+{
+    while ( count-- )
+    {
+        send(data);
+    }
+}
+
+void PicoI2c::sendRepeat16(uint16_t data, uint32_t count)
+{
+    while ( count-- )
+    {
+        send(data >> 8);
+        send(data & 0xFF);
+    }
+}
+
 
 #endif // PICO_BOARD
@@ -92,4 +92,33 @@ void PicoSpi::sendBuffer(const uint8_t *buffer, uint16_t size)
     spi_write_blocking(PICO_SPI, buffer, size);
 }
 
+void PicoSpi::sendRepeat(uint8_t data, uint32_t count)
+{
+    uint8_t chunk[32];
+    memset(chunk, data, sizeof(chunk));
+    while ( count )
+    {
+        size_t len = count > sizeof(chunk) ? sizeof(chunk) : count;
+        spi_write_blocking(PICO_SPI, chunk, len);
+        count -= len;
+    }
+}
+
+void PicoSpi::sendRepeat16(uint16_t data, uint32_t count)
+{
+    uint8_t chunk[32];
+    for ( uint8_t i = 0; i < sizeof(chunk); i += 2 )
+    {
+        chunk[i] = data >> 8;
+        chunk[i + 1] = data & 0xFF;
+    }
+    count <<= 1;
+    while ( count )
+    {
+        size_t len = count > sizeof(chunk) ? sizeof(chunk) : count;
+        spi_write_blocking(PICO_SPI, chunk, len);
+        count -= len;
+    }
+}
+
 #endif // PICO_BOARD
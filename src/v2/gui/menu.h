@@ -43,6 +43,15 @@
 #define lcd_gfx_max(x, y) ((x) > (y) ? (x) : (y))
 #endif
 
+#ifndef LCDGFX_MENU_WIDTH_CACHE
+#if defined(__AVR__)
+/** Number of menu item widths, remembered by LcdGfxMenu. 0 disables the cache */
+#define LCDGFX_MENU_WIDTH_CACHE 0
+#else
+#define LCDGFX_MENU_WIDTH_CACHE 16
+#endif
+#endif
+
 /**
  * @ingroup LCD_GENERIC_API
  * @{
@@ -91,9 +100,15 @@ public:
      * Forces the next show() to perform a full redraw (border + all visible
      * items + scroll indicators). Use this when the surrounding screen has
      * been cleared / repainted by other code and the menu needs to repaint
-     * its border too.
+     * its border too, or when text of menu items is changed.
      */
-    void invalidate() { m_initialized = false; }
+    void invalidate()
+    {
+        m_initialized = false;
+#if LCDGFX_MENU_WIDTH_CACHE > 0
+        m_widthFont = nullptr;
+#endif
+    }
 
     /**
      * Moves selection pointer down by 1 item. If there are no items below,
@@ -230,6 +245,37 @@ private:
     SAppMenu menu;
     uint8_t m_oldScrollPosition = 0;
     bool m_initialized = false;
+#if LCDGFX_MENU_WIDTH_CACHE > 0
+    const NanoFont *m_widthFont = nullptr;
+    uint8_t m_widthRevision = 0;
+    uint8_t m_widthItem[LCDGFX_MENU_WIDTH_CACHE];
+    lcduint_t m_width[LCDGFX_MENU_WIDTH_CACHE];
+#endif
+
+    /* Returns width of menu item label, measuring each label once for the font */
+    template <typename D> lcduint_t getItemWidth(D &d, uint8_t index)
+    {
+#if LCDGFX_MENU_WIDTH_CACHE > 0
+        if ( m_widthFont != &d.getFont() || m_widthRevision != d.getFont().getRevision() )
+        {
+            m_widthFont = &d.getFont();
+            m_widthRevision = d.getFont().getRevision();
+            for ( uint8_t i = 0; i < LCDGFX_MENU_WIDTH_CACHE; i++ )
+            {
+                m_widthItem[i] = 0xFF;
+            }
+        }
+        uint8_t slot = index % LCDGFX_MENU_WIDTH_CACHE;
+        if ( m_widthItem[slot] != index )
+        {
+            m_widthItem[slot] = index;
+            m_width[slot] = d.getFont().getTextSize(menu.items[index]);
+        }
+        return m_width[slot];
+#else
+        return d.getFont().getTextSize(menu.items[index]);
+#endif
+    }
 
     template <typename D> uint8_t getMaxScreenItems(D &d)
     {
@@ -263,7 +309,7 @@ private:
         // the cell backgrounds under the new text itself, so this single
         // trailing fillRect is enough — even after scrolling, when a
         // shorter label replaces a longer one at the same screen row.
-        d.fillRect(menu.left + 8 + d.getFont().getTextSize(menu.items[index]), item_top,
+        d.fillRect(menu.left + 8 + getItemWidth(d, index), item_top,
                    menu.width + menu.left - 9, item_top + d.getFont().getHeader().height - 1);
         d.setColor(color);
         d.printFixed(menu.left + 8, item_top, menu.items[index], STYLE_NORMAL);
@@ -36,11 +36,796 @@
 #include "nano_gfx_types.h"
 #include "display_base.h"
 
+#include <string.h>
+
 /**
  * @ingroup LCD_GENERIC_API
  * @{
  */
 
+/**
+ * NanoShadow1 is RAM copy of 1-bit display GDRAM with per-page dirty column ranges.
+ * It is used by NanoDisplayOps1 to draw to RAM instead of the display: pixel operations
+ * become read-modify-write, and flush() sends only changed column spans of each page.
+ * Use NanoShadowBuffer1 template to allocate the storage.
+ */
+class NanoShadow1
+{
+public:
+    /**
+     * Creates shadow over preallocated storage
+     * @param w - width of the display in pixels
+     * @param h - height of the display in pixels (must be divided by 8)
+     * @param data - storage for GDRAM copy, w * h / 8 bytes
+     * @param dirty - storage for dirty ranges, h / 4 items
+     */
+    NanoShadow1(lcduint_t w, lcduint_t h, uint8_t *data, lcduint_t *dirty)
+        : m_w(w)
+        , m_pages(h >> 3)
+        , m_data(data)
+        , m_dirty(dirty)
+    {
+    }
+
+    /**
+     * Clears GDRAM copy and marks all pages dirty, so next flush
+     * rewrites whole display.
+     */
+    void reset()
+    {
+        memset(m_data, 0, (uint16_t)m_w * m_pages);
+        for ( lcduint_t page = 0; page < m_pages; page++ )
+        {
+            m_dirty[page * 2] = 0;
+            m_dirty[page * 2 + 1] = m_w - 1;
+        }
+    }
+
+    /**
+     * Returns number of pages (8-pixel rows) in GDRAM copy
+     */
+    lcduint_t pages() const
+    {
+        return m_pages;
+    }
+
+    /**
+     * Returns pointer to GDRAM copy. Each byte represents 8 vertical pixels,
+     * the layout is the same as of NanoCanvas1.
+     */
+    const uint8_t *getData() const
+    {
+        return m_data;
+    }
+
+    /**
+     * Returns dirty column span of the page and marks the page clean
+     *
+     * @param page - page to check
+     * @param x - receives first dirty column
+     * @param w - receives number of dirty columns
+     * @return pointer to the span data or nullptr if the page is clean
+     */
+    const uint8_t *takeSpan(lcduint_t page, lcduint_t &x, lcduint_t &w)
+    {
+        lcduint_t first = m_dirty[page * 2];
+        lcduint_t last = m_dirty[page * 2 + 1];
+        if ( first > last )
+        {
+            return nullptr;
+        }
+        m_dirty[page * 2] = m_w;
+        m_dirty[page * 2 + 1] = 0;
+        x = first;
+        w = last - first + 1;
+        return &m_data[(uint16_t)page * m_w + first];
+    }
+
+    /**
+     * Fills rectangle area with color (0x00 or 0xFF), keeping other pixels
+     * of affected pages. Coordinates are clipped to the display.
+     */
+    void fillRect(lcdint_t x1, lcdint_t y1, lcdint_t x2, lcdint_t y2, uint8_t color)
+    {
+        if ( x1 < 0 )
+            x1 = 0;
+        if ( y1 < 0 )
+            y1 = 0;
+        if ( x2 >= (lcdint_t)m_w )
+            x2 = (lcdint_t)m_w - 1;
+        if ( y2 >= (lcdint_t)(m_pages << 3) )
+            y2 = (lcdint_t)(m_pages << 3) - 1;
+        if ( x1 > x2 || y1 > y2 )
+            return;
+        for ( lcduint_t page = y1 >> 3; page <= (lcduint_t)(y2 >> 3); page++ )
+        {
+            uint8_t mask = 0xFF;
+            if ( page == (lcduint_t)(y1 >> 3) )
+                mask &= (uint8_t)(0xFF << (y1 & 0x07));
+            if ( page == (lcduint_t)(y2 >> 3) )
+                mask &= (uint8_t)(0xFF >> (0x07 - (y2 & 0x07)));
+            uint8_t *p = &m_data[(uint16_t)page * m_w];
+            for ( lcdint_t x = x1; x <= x2; x++ )
+            {
+                write(x, page, (p[x] & ~mask) | (color & mask));
+            }
+        }
+    }
+
+    /**
+     * Starts block of byte writes, the same way as startBlock() of display interface
+     * @param x - column (left region)
+     * @param page - page (top region)
+     * @param w - width of the block in pixels, 0 means up to the right edge
+     */
+    void startBlock(lcduint_t x, lcduint_t page, lcduint_t w)
+    {
+        m_x0 = x;
+        m_x = x;
+        m_x1 = (w == 0 || w > m_w) ? m_w - 1 : x + w - 1;
+        m_page = page;
+    }
+
+    /**
+     * Moves block write position to the start of next page
+     */
+    void nextBlock()
+    {
+        m_x = m_x0;
+        m_page++;
+    }
+
+    /**
+     * Writes byte at block write position. Bytes outside of the block
+     * or the display are dropped.
+     * @param data - 8 vertical pixels
+     */
+    void send(uint8_t data)
+    {
+        if ( m_x <= m_x1 )
+        {
+            write(m_x, m_page, data);
+        }
+        m_x++;
+    }
+
+private:
+    lcduint_t m_w;
+    lcduint_t m_pages;
+    uint8_t *m_data;
+    lcduint_t *m_dirty;
+    lcduint_t m_x0 = 0;
+    lcduint_t m_x1 = 0;
+    lcduint_t m_x = 0;
+    lcduint_t m_page = 0;
+
+    void write(lcduint_t x, lcduint_t page, uint8_t data)
+    {
+        if ( x >= m_w || page >= m_pages )
+        {
+            return;
+        }
+        uint8_t *p = &m_data[(uint16_t)page * m_w + x];
+        if ( *p == data )
+        {
+            return;
+        }
+        *p = data;
+        if ( x < m_dirty[page * 2] )
+            m_dirty[page * 2] = x;
+        if ( x > m_dirty[page * 2 + 1] )
+            m_dirty[page * 2 + 1] = x;
+    }
+};
+
+/**
+ * Template class allocates storage for NanoShadow1
+ * @tparam W - width of the display in pixels
+ * @tparam H - height of the display in pixels
+ *
+ * @code{.cpp}
+ * DisplaySSD1306_128x64_I2C display(-1);
+ * NanoShadowBuffer1<128, 64> shadow;
+ * ...
+ * display.begin();
+ * display.setShadow(&shadow);
+ * display.drawLine(0, 0, 127, 63);
+ * display.flush();
+ * @endcode
+ */
+template <lcduint_t W, lcduint_t H> class NanoShadowBuffer1: public NanoShadow1
+{
+public:
+    NanoShadowBuffer1()
+        : NanoShadow1(W, H, m_buffer, m_spans)
+    {
+    }
+
+private:
+    uint8_t m_buffer[W * (H / 8)];
+    lcduint_t m_spans[H / 4];
+};
+
+/** Record of NanoGlyphCache slot */
+typedef struct
+{
+    const uint8_t *glyph; ///< glyph bitmap in flash, nullptr for empty slot
+    uint16_t fg;          ///< foreground color, glyph is rendered with
+    uint16_t bg;          ///< background color, glyph is rendered with
+    uint8_t width;        ///< glyph width in pixels
+    uint8_t height;       ///< glyph height in pixels
+} SGlyphCacheRecord;
+
+/**
+ * NanoGlyphCache keeps font glyphs, expanded to native pixel format of 8-bit or 16-bit
+ * display for specific foreground and background colors, so that printing the same chars
+ * again sends each glyph as single contiguous block. Use NanoGlyphCacheBuffer template
+ * to allocate the storage, and NanoDisplayOps8::setGlyphCache() or
+ * NanoDisplayOps16::setGlyphCache() to enable it.
+ */
+class NanoGlyphCache
+{
+public:
+    /**
+     * Creates cache over preallocated storage
+     * @param slots - number of glyphs to keep
+     * @param slotSize - maximum size of expanded glyph in bytes
+     * @param records - storage for slot records, slots items
+     * @param data - storage for expanded glyphs, slots * slotSize bytes
+     */
+    NanoGlyphCache(uint8_t slots, uint16_t slotSize, SGlyphCacheRecord *records, uint8_t *data)
+        : m_slots(slots)
+        , m_slotSize(slotSize)
+        , m_records(records)
+        , m_data(data)
+    {
+    }
+
+    /**
+     * Drops all cached glyphs
+     */
+    void reset()
+    {
+        for ( uint8_t i = 0; i < m_slots; i++ )
+        {
+            m_records[i].glyph = nullptr;
+        }
+        m_next = 0;
+    }
+
+    /**
+     * Returns glyph, expanded to native pixel format. If the glyph is not in the cache,
+     * it is rendered to the oldest slot.
+     *
+     * @param glyph - glyph bitmap in flash: each byte represents 8 vertical pixels
+     * @param w - width of glyph in pixels
+     * @param h - height of glyph in pixels
+     * @param fg - foreground color
+     * @param bg - background color
+     * @param bytesPerPixel - 1 for 8-bit displays, 2 for 16-bit displays
+     * @return w * h * bytesPerPixel bytes of pixel data, or nullptr if the glyph does not fit slot
+     */
+    const uint8_t *get(const uint8_t *glyph, lcduint_t w, lcduint_t h, uint16_t fg, uint16_t bg,
+                       uint8_t bytesPerPixel)
+    {
+        uint32_t size = (uint32_t)w * h * bytesPerPixel;
+        if ( !glyph || !size || size > m_slotSize || w > 0xFF || h > 0xFF )
+        {
+            return nullptr;
+        }
+        for ( uint8_t i = 0; i < m_slots; i++ )
+        {
+            const SGlyphCacheRecord &r = m_records[i];
+            if ( r.glyph == glyph && r.width == w && r.height == h && r.fg == fg && r.bg == bg )
+            {
+                return &m_data[(uint32_t)i * m_slotSize];
+            }
+        }
+        uint8_t slot = m_next;
+        m_next = (m_next + 1 >= m_slots) ? 0 : m_next + 1;
+        SGlyphCacheRecord &r = m_records[slot];
+        r.glyph = glyph;
+        r.width = w;
+        r.height = h;
+        r.fg = fg;
+        r.bg = bg;
+        uint8_t *dst = &m_data[(uint32_t)slot * m_slotSize];
+        uint8_t *p = dst;
+        for ( lcduint_t y = 0; y < h; y++ )
+        {
+            const uint8_t *src = glyph + (y >> 3) * w;
+            uint8_t bit = 1 << (y & 0x07);
+            for ( lcduint_t x = 0; x < w; x++ )
+            {
+                uint16_t pixel = (pgm_read_byte(&src[x]) & bit) ? fg : bg;
+                if ( bytesPerPixel == 2 )
+                {
+                    *p++ = pixel >> 8;
+                }
+                *p++ = pixel & 0xFF;
+            }
+        }
+        return dst;
+    }
+
+private:
+    uint8_t m_slots;
+    uint16_t m_slotSize;
+    SGlyphCacheRecord *m_records;
+    uint8_t *m_data;
+    uint8_t m_next = 0;
+};
+
+/**
+ * Template class allocates storage for NanoGlyphCache
+ * @tparam SLOTS - number of glyphs to keep
+ * @tparam SLOT_SIZE - maximum size of expanded glyph in bytes: width * height * bytes per pixel
+ *
+ * @code{.cpp}
+ * DisplayST7789_240x240x16_SPI display(3,{-1, 4, 5, 0,-1,-1});
+ * NanoGlyphCacheBuffer<32, 6 * 8 * 2> glyphs;
+ * ...
+ * display.begin();
+ * display.setGlyphCache(&glyphs);
+ * @endcode
+ */
+template <uint8_t SLOTS, uint16_t SLOT_SIZE> class NanoGlyphCacheBuffer: public NanoGlyphCache
+{
+public:
+    NanoGlyphCacheBuffer()
+        : NanoGlyphCache(SLOTS, SLOT_SIZE, m_records, m_buffer)
+    {
+    }
+
+private:
+    SGlyphCacheRecord m_records[SLOTS];
+    uint8_t m_buffer[SLOTS * SLOT_SIZE];
+};
+
+/** Solid fill, recorded by NanoCommandList */
+typedef struct
+{
+    lcdint_t x1;    ///< left position
+    lcdint_t y1;    ///< top position
+    lcdint_t x2;    ///< right position
+    lcdint_t y2;    ///< bottom position
+    uint16_t color; ///< fill color
+} SNanoFillCommand;
+
+/**
+ * NanoCommandList keeps solid fills, recorded by NanoDisplayOps in recording mode
+ * (see NanoDisplayOps::setCommandList()). Before replay the list is optimized: fills,
+ * covered by later fills, are dropped, fills of the same color, which form a rectangle,
+ * are merged, and the rest is ordered by address, so that the display gets the fewest
+ * possible address windows. Use NanoCommandListBuffer template to allocate the storage.
+ */
+class NanoCommandList
+{
+public:
+    /**
+     * Creates command list over preallocated storage
+     * @param capacity - maximum number of commands
+     * @param commands - storage for capacity commands
+     */
+    NanoCommandList(uint16_t capacity, SNanoFillCommand *commands)
+        : m_capacity(capacity)
+        , m_commands(commands)
+    {
+    }
+
+    /**
+     * Drops all recorded commands
+     */
+    void reset()
+    {
+        m_count = 0;
+    }
+
+    /**
+     * Returns number of recorded commands
+     */
+    uint16_t size() const
+    {
+        return m_count;
+    }
+
+    /**
+     * Returns recorded command
+     * @param index - index of command, 0...size() - 1
+     */
+    const SNanoFillCommand &get(uint16_t index) const
+    {
+        return m_commands[index];
+    }
+
+    /**
+     * Records solid fill
+     * @param x1 - left position
+     * @param y1 - top position
+     * @param x2 - right position
+     * @param y2 - bottom position
+     * @param color - fill color
+     * @return false if the list is full
+     */
+    bool add(lcdint_t x1, lcdint_t y1, lcdint_t x2, lcdint_t y2, uint16_t color)
+    {
+        if ( m_count >= m_capacity )
+        {
+            return false;
+        }
+        SNanoFillCommand &c = m_commands[m_count++];
+        c.x1 = x1 < x2 ? x1 : x2;
+        c.x2 = x1 < x2 ? x2 : x1;
+        c.y1 = y1 < y2 ? y1 : y2;
+        c.y2 = y1 < y2 ? y2 : y1;
+        c.color = color;
+        return true;
+    }
+
+    /**
+     * Drops overdrawn commands, merges adjacent fills of the same color and orders
+     * the commands by address. The result of replaying the commands does not change.
+     */
+    void optimize()
+    {
+        cull();
+        while ( merge() )
+        {
+            cull();
+        }
+        sort();
+    }
+
+private:
+    uint16_t m_capacity;
+    uint16_t m_count = 0;
+    SNanoFillCommand *m_commands;
+
+    static bool overlaps(const SNanoFillCommand &a, const SNanoFillCommand &b)
+    {
+        return a.x1 <= b.x2 && b.x1 <= a.x2 && a.y1 <= b.y2 && b.y1 <= a.y2;
+    }
+
+    static bool covers(const SNanoFillCommand &a, const SNanoFillCommand &b)
+    {
+        return a.x1 <= b.x1 && a.x2 >= b.x2 && a.y1 <= b.y1 && a.y2 >= b.y2;
+    }
+
+    // Returns true if union of a and b is rectangle
+    static bool joinable(const SNanoFillCommand &a, const SNanoFillCommand &b)
+    {
+        if ( a.x1 == b.x1 && a.x2 == b.x2 )
+        {
+            return a.y1 <= b.y2 + 1 && b.y1 <= a.y2 + 1;
+        }
+        if ( a.y1 == b.y1 && a.y2 == b.y2 )
+        {
+            return a.x1 <= b.x2 + 1 && b.x1 <= a.x2 + 1;
+        }
+        return covers(a, b) || covers(b, a);
+    }
+
+    // Returns true if none of commands between first and last overlaps the area
+    bool isFree(const SNanoFillCommand &area, uint16_t first, uint16_t last) const
+    {
+        for ( uint16_t k = first + 1; k < last; k++ )
+        {
+            if ( overlaps(m_commands[k], area) )
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void remove(uint16_t index)
+    {
+        m_count--;
+        memmove(&m_commands[index], &m_commands[index + 1], (m_count - index) * sizeof(SNanoFillCommand));
+    }
+
+    void cull()
+    {
+        for ( uint16_t i = 0; i < m_count; )
+        {
+            bool covered = false;
+            for ( uint16_t j = i + 1; j < m_count && !covered; j++ )
+            {
+                covered = covers(m_commands[j], m_commands[i]);
+            }
+            if ( covered )
+            {
+                remove(i);
+            }
+            else
+            {
+                i++;
+            }
+        }
+    }
+
+    bool merge()
+    {
+        for ( uint16_t j = 1; j < m_count; j++ )
+        {
+            for ( uint16_t i = 0; i < j; i++ )
+            {
+                SNanoFillCommand &a = m_commands[i];
+                SNanoFillCommand &b = m_commands[j];
+                if ( a.color != b.color || !joinable(a, b) )
+                {
+                    continue;
+                }
+                SNanoFillCommand u = {a.x1 < b.x1 ? a.x1 : b.x1, a.y1 < b.y1 ? a.y1 : b.y1,
+                                      a.x2 > b.x2 ? a.x2 : b.x2, a.y2 > b.y2 ? a.y2 : b.y2, a.color};
+                // the union is drawn either at the time of a, or at the time of b
+                if ( isFree(b, i, j) )
+                {
+                    a = u;
+                    remove(j);
+                    return true;
+                }
+                if ( isFree(a, i, j) )
+                {
+                    b = u;
+                    remove(i);
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    void sort()
+    {
+        // adjacent commands are swapped only if they do not overlap, so the result does not change
+        bool swapped = true;
+        while ( swapped )
+        {
+            swapped = false;
+            for ( uint16_t i = 1; i < m_count; i++ )
+            {
+                SNanoFillCommand &a = m_commands[i - 1];
+                SNanoFillCommand &b = m_commands[i];
+                if ( (b.y1 < a.y1 || (b.y1 == a.y1 && b.x1 < a.x1)) && !overlaps(a, b) )
+                {
+                    SNanoFillCommand t = a;
+                    a = b;
+                    b = t;
+                    swapped = true;
+                }
+            }
+        }
+    }
+};
+
+/**
+ * Template class allocates storage for NanoCommandList
+ * @tparam N - maximum number of commands
+ *
+ * @code{.cpp}
+ * DisplayST7789_240x240x16_SPI display(3,{-1, 4, 5, 0,-1,-1});
+ * NanoCommandListBuffer<64> commands;
+ * ...
+ * display.setCommandList(&commands);
+ * drawWidgets();
+ * display.flush();
+ * @endcode
+ */
+template <uint16_t N> class NanoCommandListBuffer: public NanoCommandList
+{
+public:
+    NanoCommandListBuffer()
+        : NanoCommandList(N, m_commands)
+    {
+    }
+
+private:
+    SNanoFillCommand m_commands[N];
+};
+
+/**
+ * NanoFrameDiff keeps copy of canvas data, last sent to the display with
+ * NanoDisplayOps::drawCanvas(x, y, canvas, diff). Next frame of the same canvas at the same
+ * position is compared with the copy, and only changed runs are sent: column spans of each
+ * page for 1-bit canvases, and row spans for 4-, 8- and 16-bit canvases.
+ * Use NanoFrameDiffBuffer template to allocate the storage.
+ */
+class NanoFrameDiff
+{
+public:
+    /**
+     * Creates frame copy over preallocated storage
+     * @param data - storage for canvas data
+     * @param size - size of storage in bytes
+     */
+    NanoFrameDiff(uint8_t *data, uint32_t size)
+        : m_data(data)
+        , m_size(size)
+    {
+    }
+
+    /**
+     * Forgets the last frame, so that next drawCanvas() sends whole canvas.
+     * Call it, when display content under the canvas is changed by other means,
+     * for example by clear().
+     */
+    void reset()
+    {
+        m_bits = 0;
+    }
+
+    /**
+     * Returns copy of the last frame, if it was sent for the canvas of the same
+     * geometry at the same position. Otherwise, remembers new geometry and returns nullptr:
+     * the caller sends whole canvas and stores it with store().
+     *
+     * @param x - position of the canvas on the display
+     * @param y - position of the canvas on the display
+     * @param w - width of the canvas in pixels
+     * @param h - height of the canvas in pixels
+     * @param bits - bits per pixel of the canvas
+     */
+    uint8_t *match(lcdint_t x, lcdint_t y, lcduint_t w, lcduint_t h, uint8_t bits)
+    {
+        if ( m_bits == bits && m_x == x && m_y == y && m_w == w && m_h == h )
+        {
+            return m_data;
+        }
+        m_bits = 0;
+        if ( (uint32_t)w * h * bits > m_size * 8 )
+        {
+            return nullptr;
+        }
+        m_x = x;
+        m_y = y;
+        m_w = w;
+        m_h = h;
+        m_bits = bits;
+        return nullptr;
+    }
+
+    /**
+     * Stores canvas data as the last frame, if geometry is accepted by match().
+     * @param data - canvas data
+     */
+    void store(const uint8_t *data)
+    {
+        if ( m_bits )
+        {
+            memcpy(m_data, data, (uint32_t)m_w * m_h * m_bits / 8);
+        }
+    }
+
+private:
+    uint8_t *m_data;
+    uint32_t m_size;
+    lcdint_t m_x = 0;
+    lcdint_t m_y = 0;
+    lcduint_t m_w = 0;
+    lcduint_t m_h = 0;
+    uint8_t m_bits = 0; ///< bits per pixel of the last frame, 0 if there is no valid frame
+};
+
+/**
+ * Template class allocates storage for NanoFrameDiff
+ * @tparam W - width of the canvas in pixels
+ * @tparam H - height of the canvas in pixels
+ * @tparam BPP - bits per pixel of the canvas
+ *
+ * @code{.cpp}
+ * DisplaySSD1306_128x64_I2C display(-1);
+ * NanoCanvas<128, 64, 1> canvas;
+ * NanoFrameDiffBuffer<128, 64, 1> frame;
+ * ...
+ * canvas.clear();
+ * drawClock(canvas);
+ * display.drawCanvas(0, 0, canvas, frame);
+ * @endcode
+ */
+template <lcduint_t W, lcduint_t H, uint8_t BPP> class NanoFrameDiffBuffer: public NanoFrameDiff
+{
+public:
+    NanoFrameDiffBuffer()
+        : NanoFrameDiff(m_buffer, sizeof(m_buffer))
+    {
+    }
+
+private:
+    uint8_t m_buffer[(uint32_t)W * H * BPP / 8];
+};
+
+/**
+ * @defgroup LCD_ACCEL_HOOKS Hardware acceleration hooks
+ *
+ * Lcd interface class I may implement any of the following methods to let display
+ * controller draw instead of streaming pixels:
+ * - bool accelFillRect(lcdint_t x1, lcdint_t y1, lcdint_t x2, lcdint_t y2, uint16_t color)
+ * - bool accelClear(lcdint_t x1, lcdint_t y1, lcdint_t x2, lcdint_t y2)
+ * - bool accelDrawLine(lcdint_t x1, lcdint_t y1, lcdint_t x2, lcdint_t y2, uint16_t color)
+ * - bool accelScroll(lcdint_t top, lcdint_t bottom, lcdint_t line)
+ * - bool accelPageBurst(lcduint_t x, lcduint_t w)
+ *
+ * Each method returns false, if the controller cannot execute the operation, and the
+ * library draws it in a usual way. Interfaces without these methods compile to no calls.
+ * accelScroll() has no software fallback: it makes screen rows top to bottom show GDRAM
+ * rows starting from line, wrapping to top after bottom row (refer to NanoDisplayOps::scrollUp()).
+ * accelPageBurst() returns true, if after startBlock(x, page, w) the controller moves to the next
+ * page by itself, so 1-bit operations send all pages as single data burst without nextBlock().
+ * @{
+ */
+
+/** Calls I::accelFillRect() if lcd interface implements it */
+template <class I>
+inline auto lcd_accelFillRect(I &intf, lcdint_t x1, lcdint_t y1, lcdint_t x2, lcdint_t y2, uint16_t color, int)
+    -> decltype(intf.accelFillRect(x1, y1, x2, y2, color))
+{
+    return intf.accelFillRect(x1, y1, x2, y2, color);
+}
+
+/** Fallback for lcd interfaces without hardware fill */
+template <class I> inline bool lcd_accelFillRect(I &, lcdint_t, lcdint_t, lcdint_t, lcdint_t, uint16_t, long)
+{
+    return false;
+}
+
+/** Calls I::accelClear() if lcd interface implements it */
+template <class I>
+inline auto lcd_accelClear(I &intf, lcdint_t x1, lcdint_t y1, lcdint_t x2, lcdint_t y2, int)
+    -> decltype(intf.accelClear(x1, y1, x2, y2))
+{
+    return intf.accelClear(x1, y1, x2, y2);
+}
+
+/** Fallback for lcd interfaces without hardware clear */
+template <class I> inline bool lcd_accelClear(I &, lcdint_t, lcdint_t, lcdint_t, lcdint_t, long)
+{
+    return false;
+}
+
+/** Calls I::accelDrawLine() if lcd interface implements it */
+template <class I>
+inline auto lcd_accelDrawLine(I &intf, lcdint_t x1, lcdint_t y1, lcdint_t x2, lcdint_t y2, uint16_t color, int)
+    -> decltype(intf.accelDrawLine(x1, y1, x2, y2, color))
+{
+    return intf.accelDrawLine(x1, y1, x2, y2, color);
+}
+
+/** Fallback for lcd interfaces without hardware lines */
+template <class I> inline bool lcd_accelDrawLine(I &, lcdint_t, lcdint_t, lcdint_t, lcdint_t, uint16_t, long)
+{
+    return false;
+}
+
+/** Calls I::accelScroll() if lcd interface implements it */
+template <class I>
+inline auto lcd_accelScroll(I &intf, lcdint_t top, lcdint_t bottom, lcdint_t line, int)
+    -> decltype(intf.accelScroll(top, bottom, line))
+{
+    return intf.accelScroll(top, bottom, line);
+}
+
+/** Fallback for lcd interfaces without hardware scrolling */
+template <class I> inline bool lcd_accelScroll(I &, lcdint_t, lcdint_t, lcdint_t, long)
+{
+    return false;
+}
+
+/** Calls I::accelPageBurst() if lcd interface implements it */
+template <class I>
+inline auto lcd_accelPageBurst(I &intf, lcduint_t x, lcduint_t w, int) -> decltype(intf.accelPageBurst(x, w))
+{
+    return intf.accelPageBurst(x, w);
+}
+
+/** Fallback for lcd interfaces, which need page address for each page */
+template <class I> inline bool lcd_accelPageBurst(I &, lcduint_t, lcduint_t, long)
+{
+    return false;
+}
+
+/** @} */
+
 /**
  * NanoDisplayOps1 is template class for 1-bit operations.
  */
@@ -291,7 +1076,88 @@ public:
     void printFixedN(lcdint_t xpos, lcdint_t y, const char *ch, EFontStyle style, uint8_t factor)
         __attribute__((noinline));
 
+    /**
+     * Enables drawing to RAM copy of display GDRAM. While shadow is set, all drawing
+     * functions update RAM only, and flush() must be called to send changes to the display.
+     * The shadow is cleared and marked dirty, so first flush() clears the display.
+     *
+     * @param shadow - shadow storage of the display size or nullptr to return to direct mode
+     */
+    void setShadow(NanoShadow1 *shadow);
+
+    /**
+     * Sends changed column spans of the shadow to the display.
+     * Does nothing in direct mode.
+     */
+    void flush();
+
 protected:
+    /**
+     * Draws glyph at cursor position, using current text mode and font style,
+     * and moves cursor X past the glyph. Does not wrap text.
+     *
+     * @param info glyph to draw
+     */
+    void printGlyph(const SCharInfo &info);
+
+    NanoShadow1 *m_shadow = nullptr; ///< RAM copy of GDRAM or nullptr in direct mode
+
+private:
+    void blockStart(lcduint_t x, lcduint_t page, lcduint_t w)
+    {
+        if ( m_shadow )
+            m_shadow->startBlock(x, page, w);
+        else
+            this->m_intf.startBlock(x, page, w);
+    }
+
+    void blockNext()
+    {
+        if ( m_shadow )
+            m_shadow->nextBlock();
+        else
+            this->m_intf.nextBlock();
+    }
+
+    void blockEnd()
+    {
+        if ( !m_shadow )
+            this->m_intf.endBlock();
+    }
+
+    void blockSend(uint8_t data)
+    {
+        if ( m_shadow )
+            m_shadow->send(data);
+        else
+            this->m_intf.send(data);
+    }
+
+    void blockRepeat(uint8_t data, lcduint_t count)
+    {
+        if ( !m_shadow )
+        {
+            this->m_intf.sendRepeat(data, count);
+            return;
+        }
+        while ( count-- )
+        {
+            m_shadow->send(data);
+        }
+    }
+
+    void blockBuffer(const uint8_t *buffer, lcduint_t size)
+    {
+        if ( !m_shadow )
+        {
+            this->m_intf.sendBuffer(buffer, size);
+            return;
+        }
+        while ( size-- )
+        {
+            m_shadow->send(*buffer++);
+        }
+    }
 };
 
 /**
@@ -510,6 +1376,14 @@ public:
         __attribute__((noinline));
 
 protected:
+    /**
+     * Draws glyph at cursor position, using current text mode and font style,
+     * and moves cursor X past the glyph. Does not wrap text.
+     *
+     * @param info glyph to draw
+     */
+    void printGlyph(const SCharInfo &info);
+
 private:
     lcdint_t m_lastRow = 0;
     lcdint_t m_lastColumn = 0;
@@ -731,7 +1605,26 @@ public:
     void printFixed(lcdint_t xpos, lcdint_t y, const char *ch, EFontStyle style = STYLE_NORMAL)
         __attribute__((noinline));
 
+    /**
+     * Enables cache of glyphs, expanded to native pixel format. printChar() sends cached
+     * glyphs as single block instead of expanding them bit by bit every time.
+     * @param cache - glyph cache or nullptr to disable caching
+     */
+    void setGlyphCache(NanoGlyphCache *cache);
+
 protected:
+    /**
+     * Draws glyph at cursor position, using current text mode and font style,
+     * and moves cursor X past the glyph. Does not wrap text.
+     *
+     * @param info glyph to draw
+     */
+    void printGlyph(const SCharInfo &info);
+
+    NanoGlyphCache *m_glyphCache = nullptr; ///< cache of expanded glyphs or nullptr
+
+private:
+    void drawGlyph(lcdint_t x, lcdint_t y, const SCharInfo &info);
 };
 
 /**
@@ -741,7 +1634,7 @@ template <class I> class NanoDisplayOps16: public NanoDisplayBase<I>
 {
 public:
     /** number of bits per single pixel in buffer */
-    static const uint8_t BITS_PER_PIXEL = 1;
+    static const uint8_t BITS_PER_PIXEL = 16;
 
     using NanoDisplayBase<I>::NanoDisplayBase;
 
@@ -968,7 +1861,26 @@ public:
     void printFixedN(lcdint_t xpos, lcdint_t y, const char *ch, EFontStyle style, uint8_t factor)
         __attribute__((noinline));
 
+    /**
+     * Enables cache of glyphs, expanded to native pixel format. printChar() sends cached
+     * glyphs as single block instead of expanding them bit by bit every time.
+     * @param cache - glyph cache or nullptr to disable caching
+     */
+    void setGlyphCache(NanoGlyphCache *cache);
+
 protected:
+    /**
+     * Draws glyph at cursor position, using current text mode and font style,
+     * and moves cursor X past the glyph. Does not wrap text.
+     *
+     * @param info glyph to draw
+     */
+    void printGlyph(const SCharInfo &info);
+
+    NanoGlyphCache *m_glyphCache = nullptr; ///< cache of expanded glyphs or nullptr
+
+private:
+    void drawGlyph(lcdint_t x, lcdint_t y, const SCharInfo &info);
 };
 
 /**
@@ -980,11 +1892,17 @@ template <typename O, typename I> class NanoDisplayOps: public O
 public:
     using O::O;
 
-    using O::putPixel;
-
     /** Base type for display operations class */
     typedef NanoDisplayOps<O, I> T;
 
+    /**
+     * Draws pixel on specified position
+     * @param x - position X
+     * @param y - position Y
+     * @note color can be set via setColor()
+     */
+    void putPixel(lcdint_t x, lcdint_t y);
+
     /**
      * Draws pixel on specified position
      * @param p - NanoPoint
@@ -992,6 +1910,24 @@ public:
      */
     void putPixel(const NanoPoint &p);
 
+    /**
+     * Draws horizontal line
+     * @param x1 - position X
+     * @param y1 - position Y
+     * @param x2 - position X
+     * @note color can be set via setColor()
+     */
+    void drawHLine(lcdint_t x1, lcdint_t y1, lcdint_t x2);
+
+    /**
+     * Draws vertical line
+     * @param x1 - position X
+     * @param y1 - position Y
+     * @param y2 - position Y
+     * @note color can be set via setColor()
+     */
+    void drawVLine(lcdint_t x1, lcdint_t y1, lcdint_t y2);
+
     /**
      * Draws line
      * @param x1 - position X
@@ -1026,7 +1962,15 @@ public:
      */
     void drawRect(const NanoRect &rect);
 
-    using O::fillRect;
+    /**
+     * Fills rectangle area
+     * @param x1 - position X
+     * @param y1 - position Y
+     * @param x2 - position X
+     * @param y2 - position Y
+     * @note color can be set via setColor()
+     */
+    void fillRect(lcdint_t x1, lcdint_t y1, lcdint_t x2, lcdint_t y2);
 
     /**
      * Fills rectangle area
@@ -1035,6 +1979,181 @@ public:
      */
     void fillRect(const NanoRect &rect);
 
+    /**
+     * Clears the display. Commands, recorded before, are dropped.
+     */
+    void clear();
+
+    /**
+     * Fills the display with specified color. Commands, recorded before, are dropped.
+     * @param color color to fill display with
+     */
+    void fill(uint16_t color);
+
+    /**
+     * Enables recording mode. While command list is set, putPixel(), drawHLine(), drawVLine(),
+     * fillRect() and all shapes, built from them (lines, rectangles, circles, filled shapes),
+     * are recorded to the list instead of drawing. flush() optimizes recorded commands and
+     * sends them to the display. If the list gets full, it is flushed automatically.
+     * Text, bitmaps, canvases and scrolling are not recorded: they send recorded commands
+     * first and then draw immediately, so they always appear on top of recorded shapes.
+     *
+     * @param commands - command list or nullptr to return to direct mode; pending commands
+     *        are sent to the display.
+     * @note On 1-bit displays use recording together with setShadow(): in direct mode
+     *       their fills are not pixel exact, and the order of fills matters.
+     */
+    void setCommandList(NanoCommandList *commands);
+
+    /**
+     * Sends recorded commands, and pending changes of the display (see
+     * NanoDisplayOps1::setShadow()) to the display.
+     */
+    void flush();
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+    // Operations below are not recorded. They are documented in NanoDisplayOps1 .. NanoDisplayOps16
+    // and send recorded commands before drawing to keep drawing order.
+    void drawXBitmap(lcdint_t x, lcdint_t y, lcduint_t w, lcduint_t h, const uint8_t *bitmap)
+    {
+        replayPending();
+        O::drawXBitmap(x, y, w, h, bitmap);
+    }
+
+    void gfx_drawMonoBitmap(lcdint_t x, lcdint_t y, lcduint_t w, lcduint_t h, const uint8_t *buf)
+    {
+        replayPending();
+        O::gfx_drawMonoBitmap(x, y, w, h, buf);
+    }
+
+    void drawBitmap1(lcdint_t x, lcdint_t y, lcduint_t w, lcduint_t h, const uint8_t *bitmap)
+    {
+        replayPending();
+        O::drawBitmap1(x, y, w, h, bitmap);
+    }
+
+    void drawBitmap4(lcdint_t x, lcdint_t y, lcduint_t w, lcduint_t h, const uint8_t *bitmap)
+    {
+        replayPending();
+        O::drawBitmap4(x, y, w, h, bitmap);
+    }
+
+    void drawBitmap8(lcdint_t x, lcdint_t y, lcduint_t w, lcduint_t h, const uint8_t *bitmap)
+    {
+        replayPending();
+        O::drawBitmap8(x, y, w, h, bitmap);
+    }
+
+    void drawBitmap16(lcdint_t x, lcdint_t y, lcduint_t w, lcduint_t h, const uint8_t *bitmap)
+    {
+        replayPending();
+        O::drawBitmap16(x, y, w, h, bitmap);
+    }
+
+    void drawBuffer1(lcdint_t x, lcdint_t y, lcduint_t w, lcduint_t h, const uint8_t *buffer)
+    {
+        replayPending();
+        O::drawBuffer1(x, y, w, h, buffer);
+    }
+
+    void drawBuffer1Fast(lcdint_t x, lcdint_t y, lcduint_t w, lcduint_t h, const uint8_t *buffer)
+    {
+        replayPending();
+        O::drawBuffer1Fast(x, y, w, h, buffer);
+    }
+
+    void drawBuffer4(lcdint_t x, lcdint_t y, lcduint_t w, lcduint_t h, const uint8_t *buffer)
+    {
+        replayPending();
+        O::drawBuffer4(x, y, w, h, buffer);
+    }
+
+    void drawBuffer8(lcdint_t x, lcdint_t y, lcduint_t w, lcduint_t h, const uint8_t *buffer)
+    {
+        replayPending();
+        O::drawBuffer8(x, y, w, h, buffer);
+    }
+
+    void drawBuffer16(lcdint_t x, lcdint_t y, lcduint_t w, lcduint_t h, const uint8_t *buffer)
+    {
+        replayPending();
+        O::drawBuffer16(x, y, w, h, buffer);
+    }
+
+    uint8_t printChar(uint8_t c)
+    {
+        replayPending();
+        return O::printChar(c);
+    }
+
+    size_t write(uint8_t c)
+    {
+        replayPending();
+        return O::write(c);
+    }
+
+    void printFixed(lcdint_t xpos, lcdint_t y, const char *ch, EFontStyle style = STYLE_NORMAL)
+    {
+        replayPending();
+        O::printFixed(xpos, y, ch, style);
+    }
+
+    void printFixed_oldStyle(uint8_t xpos, uint8_t y, const char *ch, EFontStyle style)
+    {
+        replayPending();
+        O::printFixed_oldStyle(xpos, y, ch, style);
+    }
+
+    void printFixedN(lcdint_t xpos, lcdint_t y, const char *ch, EFontStyle style, uint8_t factor)
+    {
+        replayPending();
+        O::printFixedN(xpos, y, ch, style, factor);
+    }
+#endif
+
+    /**
+     * Sets area for hardware scrolling and resets scroll position. Rows above top and
+     * below bottom stay in place. By default the whole display is scrolled.
+     *
+     * @param top - first row of scrolling area
+     * @param bottom - last row of scrolling area
+     * @return true if display controller can scroll the area, false otherwise
+     * @note SSD1306, SH1106 and SH1107 scroll only the whole GDRAM height, ILI9341 and
+     *       ST7789 support any area in default orientation (setRotation(0)).
+     */
+    bool setScrollArea(lcdint_t top, lcdint_t bottom);
+
+    /**
+     * Scrolls content of scrolling area up using start line (or scroll address) register
+     * of display controller: no pixels are sent. Rows, moved out at the top, appear at the
+     * bottom of the area, and only they need to be redrawn. Drawing coordinates are not
+     * scrolled: exposed rows start at returned position and wrap to the top of the area
+     * after its last row. Use scrolledY() to find drawing position of any screen row.
+     *
+     * @param lines - number of rows to scroll
+     * @return drawing position y of the first exposed row or -1 if display controller
+     *         cannot scroll, in which case the area must be redrawn by the caller.
+     * @note Monochrome displays without shadow (NanoDisplayOps1::setShadow()) write whole
+     *       pages, so use multiples of 8 for lines there.
+     */
+    lcdint_t scrollUp(lcduint_t lines);
+
+    /**
+     * Scrolls content of scrolling area down. Rows, moved out at the bottom, appear at the top
+     * of the area. Refer to scrollUp().
+     *
+     * @param lines - number of rows to scroll
+     * @return drawing position y of the first exposed row or -1 if display controller
+     *         cannot scroll.
+     */
+    lcdint_t scrollDown(lcduint_t lines);
+
+    /**
+     * Returns drawing position y of the row, currently shown at screen row y.
+     * @param y - screen row
+     */
+    lcdint_t scrolledY(lcdint_t y);
+
     /**
      * Clears rectangle area (fills with black/zero color).
      * Saves and restores the current drawing color.
@@ -1061,6 +2180,53 @@ public:
      */
     void drawCircle(lcdint_t xc, lcdint_t yc, lcdint_t r, uint8_t options = 0x0F);
 
+    /**
+     * Fills circle. Each row of the circle is drawn as single horizontal span.
+     * The filled area matches outline of drawCircle().
+     * @param x horizontal position of circle center in pixels
+     * @param y vertical position of circle center in pixels
+     * @param r circle radius in pixels
+     */
+    void fillCircle(lcdint_t x, lcdint_t y, lcdint_t r);
+
+    /**
+     * Fills rectangle with rounded corners.
+     * @param x1 - left X
+     * @param y1 - top Y
+     * @param x2 - right X
+     * @param y2 - bottom Y
+     * @param r - radius of corners in pixels
+     */
+    void fillRoundRect(lcdint_t x1, lcdint_t y1, lcdint_t x2, lcdint_t y2, lcdint_t r);
+
+    /**
+     * Fills triangle.
+     * @param x1 - position X of the first vertex
+     * @param y1 - position Y of the first vertex
+     * @param x2 - position X of the second vertex
+     * @param y2 - position Y of the second vertex
+     * @param x3 - position X of the third vertex
+     * @param y3 - position Y of the third vertex
+     */
+    void fillTriangle(lcdint_t x1, lcdint_t y1, lcdint_t x2, lcdint_t y2, lcdint_t x3, lcdint_t y3);
+
+    /**
+     * Fills convex or concave polygon, using even-odd rule.
+     * @param points - polygon vertices
+     * @param count - number of vertices
+     */
+    void fillPolygon(const NanoPoint *points, uint8_t count);
+
+    /**
+     * Draws line of specified width.
+     * @param x1 - start position X
+     * @param y1 - start position Y
+     * @param x2 - end position X
+     * @param y2 - end position Y
+     * @param width - line width in pixels
+     */
+    void drawThickLine(lcdint_t x1, lcdint_t y1, lcdint_t x2, lcdint_t y2, lcduint_t width);
+
     /**
      * Draws 1-bit canvas on lcd display
      *
@@ -1097,6 +2263,38 @@ public:
      */
     void drawCanvas(lcdint_t x, lcdint_t y, NanoCanvasOps<16> &canvas) __attribute__((noinline));
 
+    /**
+     * Draws canvas on lcd display, sending only runs, changed since the last frame,
+     * stored in diff. If diff keeps no frame for the canvas at this position, whole
+     * canvas is sent.
+     *
+     * @param x x position in pixels
+     * @param y y position in pixels
+     * @param canvas canvas to draw on the screen.
+     * @param diff copy of the last frame, sent to the display
+     */
+    template <uint8_t BPP> void drawCanvas(lcdint_t x, lcdint_t y, NanoCanvasOps<BPP> &canvas, NanoFrameDiff &diff)
+    {
+        replayPending();
+        drawBufferDiff(x, y, canvas.width(), canvas.height(), canvas.getData(), BPP, diff);
+    }
+
+    /**
+     * Draws only area of the canvas, changed since previous drawCanvasDirty() call
+     * (refer to NanoCanvasOps::getDirtyRect()), and marks the canvas unchanged.
+     * For 1-bit canvases the area is extended to whole pages.
+     *
+     * @param x x position of the canvas in pixels
+     * @param y y position of the canvas in pixels
+     * @param canvas canvas to draw on the screen.
+     */
+    template <uint8_t BPP> void drawCanvasDirty(lcdint_t x, lcdint_t y, NanoCanvasOps<BPP> &canvas)
+    {
+        replayPending();
+        drawBufferRect(x, y, canvas.width(), canvas.getData(), BPP, canvas.getDirtyRect());
+        canvas.resetDirty();
+    }
+
     /**
      * Print text at specified position to canvas
      *
@@ -1110,8 +2308,6 @@ public:
     void printFixedPgm(lcdint_t xpos, lcdint_t y, const char *ch, EFontStyle style = STYLE_NORMAL)
         __attribute__((noinline));
 
-    using O::write;
-
     /**
      * Prints text at current cursor position.
      * To specify cursor position using setTextCursor() method.
@@ -1120,6 +2316,20 @@ public:
      */
     void write(const char *str);
 
+    /**
+     * Draws glyphs of text run, decoded by NanoFont::decodeTextRun(). Glyphs are drawn
+     * by the same code as write(), so output is pixel-identical: current color, text mode,
+     * font style and glyph cache apply. Text cursor is not changed.
+     * Line breaks are ignored, use NanoFont::wrapTextRun() to split the run to lines.
+     *
+     * @param x position X in pixels
+     * @param y position Y in pixels
+     * @param glyphs glyph records
+     * @param count number of glyph records to draw
+     * @return position X after the last glyph
+     */
+    lcdint_t drawTextRun(lcdint_t x, lcdint_t y, const SGlyphRecord *glyphs, uint16_t count);
+
     /**
      * Prints number at current cursor position
      * To specify cursor position using setTextCursor() method.
@@ -1247,6 +2457,30 @@ protected:
      * closes interface to lcd display
      */
     virtual void end() = 0;
+
+    NanoCommandList *m_commands = nullptr; ///< recorded commands or nullptr in direct mode
+    lcdint_t m_scrollTop = 0;              ///< first row of scrolling area
+    lcdint_t m_scrollBottom = -1;          ///< last row of scrolling area, -1 if area is not set yet
+    lcdint_t m_scrollLine = 0;             ///< drawing row, shown at the top of scrolling area
+
+private:
+    lcdint_t scrollTo(lcdint_t line);
+    void drawBufferDiff(lcdint_t x, lcdint_t y, lcduint_t w, lcduint_t h, const uint8_t *buf, uint8_t bits,
+                        NanoFrameDiff &diff);
+    void drawBufferBits(lcdint_t x, lcdint_t y, lcduint_t w, lcduint_t h, const uint8_t *buf, uint8_t bits);
+    void drawBufferRect(lcdint_t x, lcdint_t y, lcduint_t w, const uint8_t *buf, uint8_t bits, const NanoRect &rect);
+    void drawCircleRun(lcdint_t xc, lcdint_t yc, lcdint_t y, lcdint_t xs, lcdint_t xe, uint8_t options);
+    void record(lcdint_t x1, lcdint_t y1, lcdint_t x2, lcdint_t y2);
+    void replay();
+
+    /** Sends recorded commands before operation, which draws immediately */
+    void replayPending()
+    {
+        if ( m_commands && m_commands->size() )
+        {
+            replay();
+        }
+    }
 };
 
 #include "ssd1306_1bit.inl"
@@ -39,6 +39,40 @@
  * @{
  */
 
+/**
+ * Size of stack buffer, used by display operations to prepare pixel data
+ * before passing it to communication interface via sendBuffer().
+ * Must hold at least 8 16-bit pixels (16 bytes): 1-bit bitmaps and buffers are
+ * expanded by groups of 8 pixels.
+ */
+#ifndef CONFIG_LCDGFX_SEND_CHUNK_SIZE
+#if defined(__AVR__)
+#define CONFIG_LCDGFX_SEND_CHUNK_SIZE 16
+#else
+#define CONFIG_LCDGFX_SEND_CHUNK_SIZE 128
+#endif
+#endif
+
+static_assert(CONFIG_LCDGFX_SEND_CHUNK_SIZE >= 16, "CONFIG_LCDGFX_SEND_CHUNK_SIZE must be at least 16 bytes");
+
+/**
+ * Time in nanoseconds, which display controller is assumed to spend per pixel,
+ * when it executes hardware fill, line or copy command. Next command is sent
+ * only after this time elapses. 0 (default) sends next command at once: set it,
+ * if the bus is fast enough to outrun the controller (about 500 for SSD1331).
+ */
+#ifndef CONFIG_LCDGFX_ACCEL_NS_PER_PIXEL
+#define CONFIG_LCDGFX_ACCEL_NS_PER_PIXEL 0
+#endif
+
+/**
+ * Number of unchanged bytes, which NanoDisplayOps::drawCanvas() with NanoFrameDiff sends
+ * between two changed runs of the same canvas row rather than starting new address window.
+ */
+#ifndef CONFIG_LCDGFX_DIFF_MIN_GAP
+#define CONFIG_LCDGFX_DIFF_MIN_GAP 8
+#endif
+
 #ifdef __cplusplus
 extern "C"
 {
@@ -108,6 +142,14 @@ public:
         return m_h;
     }
 
+    /**
+     * Sends pending changes to the display. Displays, which draw directly to GDRAM,
+     * have nothing to send.
+     */
+    void flush()
+    {
+    }
+
     /**
      * Swaps width and height dimensions
      */
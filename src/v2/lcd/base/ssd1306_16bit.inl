@@ -23,6 +23,7 @@
 */
 
 #include "lcd_hal/io.h"
+#include "canvas/internal/display_kernels.h"
 
 #if 0
 void    ssd1306_setRgbColor16(uint8_t r, uint8_t g, uint8_t b)
@@ -175,24 +176,28 @@ template <class I> void NanoDisplayOps16<I>::putPixel(lcdint_t x, lcdint_t y)
 
 template <class I> void NanoDisplayOps16<I>::drawHLine(lcdint_t x1, lcdint_t y1, lcdint_t x2)
 {
+    if ( x1 <= x2 && lcd_accelFillRect(this->m_intf, x1, y1, x2, y1, this->m_color, 0) )
+    {
+        return;
+    }
     this->m_intf.startBlock(x1, y1, 0);
-    while ( x1 <= x2 )
+    if ( x1 <= x2 )
     {
-        this->m_intf.send(this->m_color >> 8);
-        this->m_intf.send(this->m_color & 0xFF);
-        x1++;
+        this->m_intf.sendRepeat16(this->m_color, x2 - x1 + 1);
     }
     this->m_intf.endBlock();
 }
 
 template <class I> void NanoDisplayOps16<I>::drawVLine(lcdint_t x1, lcdint_t y1, lcdint_t y2)
 {
+    if ( y1 <= y2 && lcd_accelFillRect(this->m_intf, x1, y1, x1, y2, this->m_color, 0) )
+    {
+        return;
+    }
     this->m_intf.startBlock(x1, y1, 1);
-    while ( y1 <= y2 )
+    if ( y1 <= y2 )
     {
-        this->m_intf.send(this->m_color >> 8);
-        this->m_intf.send(this->m_color & 0xFF);
-        y1++;
+        this->m_intf.sendRepeat16(this->m_color, y2 - y1 + 1);
     }
     this->m_intf.endBlock();
 }
@@ -207,30 +212,34 @@ template <class I> void NanoDisplayOps16<I>::fillRect(lcdint_t x1, lcdint_t y1,
     {
         ssd1306_swap_data(x1, x2, lcdint_t);
     }
-    this->m_intf.startBlock(x1, y1, x2 - x1 + 1);
-    uint16_t count = (x2 - x1 + 1) * (y2 - y1 + 1);
-    while ( count-- )
+    if ( lcd_accelFillRect(this->m_intf, x1, y1, x2, y2, this->m_color, 0) )
     {
-        this->m_intf.send(this->m_color >> 8);
-        this->m_intf.send(this->m_color & 0xFF);
+        return;
     }
+    this->m_intf.startBlock(x1, y1, x2 - x1 + 1);
+    uint32_t count = (uint32_t)(x2 - x1 + 1) * (uint32_t)(y2 - y1 + 1);
+    this->m_intf.sendRepeat16(this->m_color, count);
     this->m_intf.endBlock();
 }
 
 template <class I> void NanoDisplayOps16<I>::fill(uint16_t color)
 {
-    this->m_intf.startBlock(0, 0, 0);
-    uint32_t count = (uint32_t)this->m_w * (uint32_t)this->m_h;
-    while ( count-- )
+    if ( lcd_accelFillRect(this->m_intf, 0, 0, this->m_w - 1, this->m_h - 1, color, 0) )
     {
-        this->m_intf.send(color >> 8);
-        this->m_intf.send(color & 0xFF);
+        return;
     }
+    this->m_intf.startBlock(0, 0, 0);
+    uint32_t count = (uint32_t)this->m_w * (uint32_t)this->m_h;
+    this->m_intf.sendRepeat16(color, count);
     this->m_intf.endBlock();
 }
 
 template <class I> void NanoDisplayOps16<I>::clear()
 {
+    if ( lcd_accelClear(this->m_intf, 0, 0, this->m_w - 1, this->m_h - 1, 0) )
+    {
+        return;
+    }
     fill(0x00);
 }
 
@@ -243,38 +252,35 @@ void NanoDisplayOps16<I>::drawXBitmap(lcdint_t x, lcdint_t y, lcduint_t w, lcdui
 template <class I>
 void NanoDisplayOps16<I>::drawBitmap1(lcdint_t xpos, lcdint_t ypos, lcduint_t w, lcduint_t h, const uint8_t *bitmap)
 {
-    uint8_t bit = 1;
-    uint16_t blackColor = this->m_bgColor;
-    uint16_t color = this->m_color;
+    uint8_t buf[CONFIG_LCDGFX_SEND_CHUNK_SIZE];
+    uint8_t lut[DISPLAY_LUT1_SIZE(2)];
+    uint16_t len = 0;
+    display_lut1(lut, this->m_color, this->m_bgColor, 2);
     this->m_intf.startBlock(xpos, ypos, w);
-    while ( h-- )
+    for ( lcduint_t row = 0; row < h; row++ )
     {
-        lcduint_t wx = w;
-        while ( wx-- )
+        const uint8_t *cols = bitmap + (row >> 3) * w;
+        for ( lcduint_t x = 0; x < w; x += 8 )
         {
-            uint8_t data = pgm_read_byte(bitmap);
-            if ( data & bit )
+            uint8_t count = w - x < 8 ? w - x : 8;
+            uint8_t data[8] = {0};
+            for ( uint8_t i = 0; i < count; i++ )
             {
-                this->m_intf.send(color >> 8);
-                this->m_intf.send(color & 0xFF);
+                data[i] = pgm_read_byte(cols + x + i);
             }
-            else
+            if ( len + count * 2 > sizeof(buf) )
             {
-                this->m_intf.send(blackColor >> 8);
-                this->m_intf.send(blackColor & 0xFF);
+                this->m_intf.sendBuffer(buf, len);
+                len = 0;
             }
-            bitmap++;
-        }
-        bit <<= 1;
-        if ( bit == 0 )
-        {
-            bit = 1;
-        }
-        else
-        {
-            bitmap -= w;
+            display_expand1(buf + len, data, count, row & 7, lut, 2);
+            len += count * 2;
         }
     }
+    if ( len )
+    {
+        this->m_intf.sendBuffer(buf, len);
+    }
     this->m_intf.endBlock();
 }
 
@@ -287,28 +293,49 @@ void NanoDisplayOps16<I>::drawBitmap4(lcdint_t x, lcdint_t y, lcduint_t w, lcdui
 template <class I>
 void NanoDisplayOps16<I>::drawBitmap8(lcdint_t x, lcdint_t y, lcduint_t w, lcduint_t h, const uint8_t *bitmap)
 {
+    uint8_t buf[CONFIG_LCDGFX_SEND_CHUNK_SIZE];
+    uint16_t len = 0;
     this->m_intf.startBlock(x, y, w);
-    uint32_t count = (w) * (h);
+    uint32_t count = (uint32_t)(w) * (h);
     while ( count-- )
     {
         uint16_t color = RGB8_TO_RGB16(pgm_read_byte(bitmap));
-        this->m_intf.send(color >> 8);
-        this->m_intf.send(color & 0xFF);
+        buf[len++] = color >> 8;
+        buf[len++] = color & 0xFF;
+        if ( len >= sizeof(buf) )
+        {
+            this->m_intf.sendBuffer(buf, len);
+            len = 0;
+        }
         bitmap++;
     }
+    if ( len )
+    {
+        this->m_intf.sendBuffer(buf, len);
+    }
     this->m_intf.endBlock();
 }
 
 template <class I>
 void NanoDisplayOps16<I>::drawBitmap16(lcdint_t x, lcdint_t y, lcduint_t w, lcduint_t h, const uint8_t *bitmap)
 {
+    uint8_t buf[CONFIG_LCDGFX_SEND_CHUNK_SIZE];
+    uint16_t len = 0;
     this->m_intf.startBlock(x, y, w);
-    uint32_t count = (w) * (h);
+    uint32_t count = (uint32_t)(w) * (h) * 2;
     while ( count-- )
     {
-        this->m_intf.send(pgm_read_byte(&bitmap[0]));
-        this->m_intf.send(pgm_read_byte(&bitmap[1]));
-        bitmap += 2;
+        buf[len++] = pgm_read_byte(bitmap);
+        if ( len >= sizeof(buf) )
+        {
+            this->m_intf.sendBuffer(buf, len);
+            len = 0;
+        }
+        bitmap++;
+    }
+    if ( len )
+    {
+        this->m_intf.sendBuffer(buf, len);
     }
     this->m_intf.endBlock();
 }
@@ -316,36 +343,20 @@ void NanoDisplayOps16<I>::drawBitmap16(lcdint_t x, lcdint_t y, lcduint_t w, lcdu
 template <class I>
 void NanoDisplayOps16<I>::drawBuffer1(lcdint_t xpos, lcdint_t ypos, lcduint_t w, lcduint_t h, const uint8_t *buffer)
 {
-    uint8_t bit = 1;
-    uint16_t blackColor = this->m_bgColor;
-    uint16_t color = this->m_color;
+    uint8_t buf[CONFIG_LCDGFX_SEND_CHUNK_SIZE];
+    uint8_t lut[DISPLAY_LUT1_SIZE(2)];
+    // whole groups of 8 pixels per chunk
+    const lcduint_t chunk = (sizeof(buf) / 2) & ~7;
+    display_lut1(lut, this->m_color, this->m_bgColor, 2);
     this->m_intf.startBlock(xpos, ypos, w);
-    while ( h-- )
+    for ( lcduint_t row = 0; row < h; row++ )
     {
-        lcduint_t wx = w;
-        while ( wx-- )
-        {
-            uint8_t data = *buffer;
-            if ( data & bit )
-            {
-                this->m_intf.send(color >> 8);
-                this->m_intf.send(color & 0xFF);
-            }
-            else
-            {
-                this->m_intf.send(blackColor >> 8);
-                this->m_intf.send(blackColor & 0xFF);
-            }
-            buffer++;
-        }
-        bit <<= 1;
-        if ( bit == 0 )
+        const uint8_t *cols = buffer + (row >> 3) * w;
+        for ( lcduint_t x = 0; x < w; x += chunk )
         {
-            bit = 1;
-        }
-        else
-        {
-            buffer -= w;
+            lcduint_t len = w - x < chunk ? w - x : chunk;
+            display_row1(buf, cols + x, len, row & 7, lut, 2);
+            this->m_intf.sendBuffer(buf, len * 2);
         }
     }
     this->m_intf.endBlock();
@@ -366,14 +377,16 @@ void NanoDisplayOps16<I>::drawBuffer4(lcdint_t x, lcdint_t y, lcduint_t w, lcdui
 template <class I>
 void NanoDisplayOps16<I>::drawBuffer8(lcdint_t x, lcdint_t y, lcduint_t w, lcduint_t h, const uint8_t *buffer)
 {
+    uint8_t buf[CONFIG_LCDGFX_SEND_CHUNK_SIZE];
     this->m_intf.startBlock(x, y, w);
-    uint32_t count = (w) * (h);
-    while ( count-- )
+    uint32_t count = (uint32_t)(w) * (h);
+    while ( count )
     {
-        uint16_t color = RGB8_TO_RGB16((*buffer));
-        this->m_intf.send(color >> 8);
-        this->m_intf.send(color & 0xFF);
-        buffer++;
+        uint16_t len = count < sizeof(buf) / 2 ? count : sizeof(buf) / 2;
+        display_rgb8to16(buf, buffer, len);
+        this->m_intf.sendBuffer(buf, len * 2);
+        buffer += len;
+        count -= len;
     }
     this->m_intf.endBlock();
 }
@@ -382,45 +395,76 @@ template <class I>
 void NanoDisplayOps16<I>::drawBuffer16(lcdint_t x, lcdint_t y, lcduint_t w, lcduint_t h, const uint8_t *buffer)
 {
     this->m_intf.startBlock(x, y, w);
-    uint32_t count = (w) * (h);
-    while ( count-- )
+    uint32_t count = (uint32_t)(w) * (h) * 2;
+    while ( count )
     {
-        this->m_intf.send(buffer[0]);
-        this->m_intf.send(buffer[1]);
-        buffer += 2;
+        /* sendBuffer() accepts up to 64KiB, so split large areas */
+        uint16_t len = count > 0x8000 ? 0x8000 : count;
+        this->m_intf.sendBuffer(buffer, len);
+        buffer += len;
+        count -= len;
     }
     this->m_intf.endBlock();
 }
 
-template <class I> uint8_t NanoDisplayOps16<I>::printChar(uint8_t c)
+template <class I> void NanoDisplayOps16<I>::setGlyphCache(NanoGlyphCache *cache)
+{
+    m_glyphCache = cache;
+    if ( m_glyphCache )
+    {
+        m_glyphCache->reset();
+    }
+}
+
+template <class I> void NanoDisplayOps16<I>::drawGlyph(lcdint_t x, lcdint_t y, const SCharInfo &info)
+{
+    const uint8_t *data = m_glyphCache ? m_glyphCache->get(info.glyph, info.width, info.height, this->m_color,
+                                                           this->m_bgColor, 2)
+                                       : nullptr;
+    if ( !data )
+    {
+        this->drawBitmap1(x, y, info.width, info.height, info.glyph);
+        return;
+    }
+    this->m_intf.startBlock(x, y, info.width);
+    this->m_intf.sendBuffer(data, info.width * info.height * 2);
+    this->m_intf.endBlock();
+}
+
+template <class I> void NanoDisplayOps16<I>::printGlyph(const SCharInfo &info)
 {
-    uint16_t unicode = this->m_font->unicode16FromUtf8(c);
-    if ( unicode == SSD1306_MORE_CHARS_REQUIRED )
-        return 0;
-    SCharInfo char_info;
-    this->m_font->getCharBitmap(unicode, &char_info);
     uint8_t mode = this->m_textMode;
     for ( uint8_t i = 0; i < (this->m_fontStyle == STYLE_BOLD ? 2 : 1); i++ )
     {
-        this->drawBitmap1(this->m_cursorX + i, this->m_cursorY, char_info.width, char_info.height, char_info.glyph);
+        drawGlyph(this->m_cursorX + i, this->m_cursorY, info);
         this->m_textMode |= CANVAS_MODE_TRANSPARENT;
     }
     this->m_textMode = mode;
-    if ( char_info.height < (lcdint_t)this->m_font->getHeader().height )
+    if ( info.height < (lcdint_t)this->m_font->getHeader().height )
     {
         this->invertColors();
-        this->fillRect(this->m_cursorX, this->m_cursorY + char_info.height, this->m_cursorX + char_info.width - 1,
+        this->fillRect(this->m_cursorX, this->m_cursorY + info.height, this->m_cursorX + info.width - 1,
                        this->m_cursorY + (lcdint_t)this->m_font->getHeader().height - 1);
         this->invertColors();
     }
-    this->m_cursorX += (lcdint_t)(char_info.width + char_info.spacing);
-    if ( char_info.spacing > 0 )
+    this->m_cursorX += (lcdint_t)(info.width + info.spacing);
+    if ( info.spacing > 0 )
     {
         this->invertColors();
-        this->fillRect(this->m_cursorX - char_info.spacing, this->m_cursorY, this->m_cursorX - 1,
+        this->fillRect(this->m_cursorX - info.spacing, this->m_cursorY, this->m_cursorX - 1,
                        this->m_cursorY + (lcdint_t)this->m_font->getHeader().height - 1);
         this->invertColors();
     }
+}
+
+template <class I> uint8_t NanoDisplayOps16<I>::printChar(uint8_t c)
+{
+    uint16_t unicode = this->m_font->unicode16FromUtf8(c);
+    if ( unicode == SSD1306_MORE_CHARS_REQUIRED )
+        return 0;
+    SCharInfo char_info;
+    this->m_font->getCharBitmap(unicode, &char_info);
+    printGlyph(char_info);
     if ( ((this->m_textMode & CANVAS_TEXT_WRAP_LOCAL) &&
           (this->m_cursorX > ((lcdint_t)this->m_w - (lcdint_t)this->m_font->getHeader().width))) ||
          ((this->m_textMode & CANVAS_TEXT_WRAP) &&
@@ -41,7 +41,7 @@ template <class I> void NanoDisplayOps1<I>::printFixed(lcdint_t xpos, lcdint_t y
     uint8_t page_offset = 0;
     uint8_t x = xpos;
     y >>= 3;
-    this->m_intf.startBlock(xpos, y, this->m_w - xpos);
+    blockStart(xpos, y, this->m_w - xpos);
     for ( ;; )
     {
         uint8_t ldata;
@@ -67,8 +67,8 @@ template <class I> void NanoDisplayOps1<I>::printFixed(lcdint_t xpos, lcdint_t y
             {
                 j = text_index;
             }
-            this->m_intf.endBlock();
-            this->m_intf.startBlock(xpos, y, this->m_w - xpos);
+            blockEnd();
+            blockStart(xpos, y, this->m_w - xpos);
         }
         uint16_t unicode;
         do
@@ -102,7 +102,7 @@ template <class I> void NanoDisplayOps1<I>::printFixed(lcdint_t xpos, lcdint_t y
                     data = (temp & 0xF0) | ldata;
                     ldata = (temp & 0x0F);
                 }
-                this->m_intf.send(data ^ this->m_bgColor);
+                blockSend(data ^ this->m_bgColor);
                 char_info.glyph++;
             }
         }
@@ -111,26 +111,31 @@ template <class I> void NanoDisplayOps1<I>::printFixed(lcdint_t xpos, lcdint_t y
             char_info.spacing += char_info.width;
         }
         for ( i = 0; i < char_info.spacing; i++ )
-            this->m_intf.send(this->m_bgColor);
+            blockSend(this->m_bgColor);
     }
-    this->m_intf.endBlock();
+    blockEnd();
 }
 
-template <class I> uint8_t NanoDisplayOps1<I>::printChar(uint8_t c)
+template <class I> void NanoDisplayOps1<I>::printGlyph(const SCharInfo &info)
 {
-    uint16_t unicode = this->m_font->unicode16FromUtf8(c);
-    if ( unicode == SSD1306_MORE_CHARS_REQUIRED )
-        return 0;
-    SCharInfo char_info;
-    this->m_font->getCharBitmap(unicode, &char_info);
     uint8_t mode = this->m_textMode;
     for ( uint8_t i = 0; i < (this->m_fontStyle == STYLE_BOLD ? 2 : 1); i++ )
     {
-        this->drawBitmap1(this->m_cursorX + i, this->m_cursorY, char_info.width, char_info.height, char_info.glyph);
+        this->drawBitmap1(this->m_cursorX + i, this->m_cursorY, info.width, info.height, info.glyph);
         this->m_textMode |= CANVAS_MODE_TRANSPARENT;
     }
     this->m_textMode = mode;
-    this->m_cursorX += (lcdint_t)(char_info.width + char_info.spacing);
+    this->m_cursorX += (lcdint_t)(info.width + info.spacing);
+}
+
+template <class I> uint8_t NanoDisplayOps1<I>::printChar(uint8_t c)
+{
+    uint16_t unicode = this->m_font->unicode16FromUtf8(c);
+    if ( unicode == SSD1306_MORE_CHARS_REQUIRED )
+        return 0;
+    SCharInfo char_info;
+    this->m_font->getCharBitmap(unicode, &char_info);
+    printGlyph(char_info);
     if ( ((this->m_textMode & CANVAS_TEXT_WRAP_LOCAL) &&
           (this->m_cursorX > ((lcdint_t)this->m_w - (lcdint_t)this->m_font->getHeader().width))) ||
          ((this->m_textMode & CANVAS_TEXT_WRAP) &&
@@ -174,7 +179,7 @@ void NanoDisplayOps1<I>::printFixed_oldStyle(uint8_t xpos, uint8_t y, const char
     uint8_t page_offset = 0;
     uint8_t x = xpos;
     y >>= 3;
-    this->m_intf.startBlock(xpos, y, this->m_w - xpos);
+    blockStart(xpos, y, this->m_w - xpos);
     for ( ;; )
     {
         uint8_t c;
@@ -202,8 +207,8 @@ void NanoDisplayOps1<I>::printFixed_oldStyle(uint8_t xpos, uint8_t y, const char
             {
                 j = text_index;
             }
-            this->m_intf.endBlock();
-            this->m_intf.startBlock(xpos, y, this->m_w - xpos);
+            blockEnd();
+            blockStart(xpos, y, this->m_w - xpos);
         }
         c = ch[j];
         if ( c >= this->m_font->getHeader().ascii_offset )
@@ -231,13 +236,13 @@ void NanoDisplayOps1<I>::printFixed_oldStyle(uint8_t xpos, uint8_t y, const char
                 data = (temp & 0xF0) | ldata;
                 ldata = (temp & 0x0F);
             }
-            this->m_intf.send(data ^ this->m_bgColor);
+            blockSend(data ^ this->m_bgColor);
             offset++;
         }
         x += this->m_font->getHeader().width;
         j++;
     }
-    this->m_intf.endBlock();
+    blockEnd();
 }
 #endif
 
@@ -249,7 +254,7 @@ void NanoDisplayOps1<I>::printFixedN(lcdint_t xpos, lcdint_t y, const char *ch,
     uint8_t page_offset = 0;
     uint8_t x = xpos;
     y >>= 3;
-    this->m_intf.startBlock(xpos, y, this->m_w - xpos);
+    blockStart(xpos, y, this->m_w - xpos);
     for ( ;; )
     {
         uint8_t ldata;
@@ -275,8 +280,8 @@ void NanoDisplayOps1<I>::printFixedN(lcdint_t xpos, lcdint_t y, const char *ch,
             {
                 j = text_index;
             }
-            this->m_intf.endBlock();
-            this->m_intf.startBlock(xpos, y, this->m_w - xpos);
+            blockEnd();
+            blockStart(xpos, y, this->m_w - xpos);
         }
         uint16_t unicode;
         do
@@ -327,7 +332,7 @@ void NanoDisplayOps1<I>::printFixedN(lcdint_t xpos, lcdint_t y, const char *ch,
                 }
                 for ( uint8_t z = (1 << factor); z > 0; z-- )
                 {
-                    this->m_intf.send(data ^ this->m_bgColor);
+                    blockSend(data ^ this->m_bgColor);
                 }
                 char_info.glyph++;
             }
@@ -337,54 +342,75 @@ void NanoDisplayOps1<I>::printFixedN(lcdint_t xpos, lcdint_t y, const char *ch,
             char_info.spacing += char_info.width;
         }
         for ( i = 0; i < (char_info.spacing << factor); i++ )
-            this->m_intf.send(this->m_bgColor);
+            blockSend(this->m_bgColor);
     }
-    this->m_intf.stop();
+    if ( !m_shadow )
+        this->m_intf.stop();
 }
 
 template <class I> void NanoDisplayOps1<I>::putPixel(lcdint_t x, lcdint_t y)
 {
-    this->m_intf.startBlock(x, y >> 3, 1);
-    this->m_intf.send((1 << (y & 0x07)) ^ this->m_bgColor);
-    this->m_intf.endBlock();
+    if ( m_shadow )
+    {
+        m_shadow->fillRect(x, y, x, y, this->m_color);
+        return;
+    }
+    blockStart(x, y >> 3, 1);
+    blockSend((1 << (y & 0x07)) ^ this->m_bgColor);
+    blockEnd();
 }
 
 template <class I> void NanoDisplayOps1<I>::drawHLine(lcdint_t x1, lcdint_t y1, lcdint_t x2)
 {
-    this->m_intf.startBlock(x1, y1 >> 3, x2 - x1 + 1);
-    for ( uint8_t x = x1; x <= x2; x++ )
+    if ( m_shadow )
+    {
+        m_shadow->fillRect(x1, y1, x2, y1, this->m_color);
+        return;
+    }
+    blockStart(x1, y1 >> 3, x2 - x1 + 1);
+    if ( x1 <= x2 )
     {
-        this->m_intf.send((1 << (y1 & 0x07)) ^ (~this->m_color));
+        blockRepeat((1 << (y1 & 0x07)) ^ (~this->m_color), x2 - x1 + 1);
     }
-    this->m_intf.endBlock();
+    blockEnd();
 }
 
 template <class I> void NanoDisplayOps1<I>::drawVLine(lcdint_t x1, lcdint_t y1, lcdint_t y2)
 {
+    if ( m_shadow )
+    {
+        m_shadow->fillRect(x1, y1, x1, y2, this->m_color);
+        return;
+    }
     uint8_t topPage = y1 >> 3;
     uint8_t bottomPage = y2 >> 3;
     uint8_t height = y2 - y1;
     uint8_t y;
-    this->m_intf.startBlock(x1, topPage, 1);
+    blockStart(x1, topPage, 1);
     if ( topPage == bottomPage )
     {
-        this->m_intf.send(((0xFF >> (0x07 - height)) << (y1 & 0x07)) ^ (~this->m_color));
-        this->m_intf.endBlock();
+        blockSend(((0xFF >> (0x07 - height)) << (y1 & 0x07)) ^ (~this->m_color));
+        blockEnd();
         return;
     }
-    this->m_intf.send((0xFF << (y1 & 0x07)) ^ (~this->m_color));
+    blockSend((0xFF << (y1 & 0x07)) ^ (~this->m_color));
     for ( y = (topPage + 1); y <= (bottomPage - 1); y++ )
     {
-        this->m_intf.nextBlock();
-        this->m_intf.send(0xFF ^ (~this->m_color));
+        blockNext();
+        blockSend(0xFF ^ (~this->m_color));
     }
-    this->m_intf.nextBlock();
-    this->m_intf.send((0xFF >> (0x07 - (y2 & 0x07))) ^ (~this->m_color));
-    this->m_intf.endBlock();
+    blockNext();
+    blockSend((0xFF >> (0x07 - (y2 & 0x07))) ^ (~this->m_color));
+    blockEnd();
 }
 
 template <class I> void NanoDisplayOps1<I>::fillRect(lcdint_t x1, lcdint_t y1, lcdint_t x2, lcdint_t y2)
 {
+    if ( m_shadow )
+    {
+        m_shadow->fillRect(x1, y1, x2, y2, this->m_color);
+        return;
+    }
     uint8_t templ = this->m_color;
     if ( x1 > x2 )
         return;
@@ -396,7 +422,7 @@ template <class I> void NanoDisplayOps1<I>::fillRect(lcdint_t x1, lcdint_t y1, l
         y2 = (lcdint_t)this->m_h - 1;
     uint8_t bank1 = (y1 >> 3);
     uint8_t bank2 = (y2 >> 3);
-    this->m_intf.startBlock(x1, bank1, x2 - x1 + 1);
+    blockStart(x1, bank1, x2 - x1 + 1);
     for ( uint8_t bank = bank1; bank <= bank2; bank++ )
     {
         uint8_t mask = 0xFF;
@@ -412,15 +438,10 @@ template <class I> void NanoDisplayOps1<I>::fillRect(lcdint_t x1, lcdint_t y1, l
         {
             mask = (mask >> (7 - (y2 & 7)));
         }
-        for ( uint8_t x = x1; x <= x2; x++ )
-        {
-            //            m_bytes[BADDR(bank) + x] &= ~mask;
-            //            m_bytes[BADDR(bank) + x] |= (templ & mask);
-            this->m_intf.send(templ & mask);
-        }
-        this->m_intf.nextBlock();
+        blockRepeat(templ & mask, x2 - x1 + 1);
+        blockNext();
     }
-    this->m_intf.endBlock();
+    blockEnd();
 }
 
 template <class I> void NanoDisplayOps1<I>::clear()
@@ -443,7 +464,7 @@ void NanoDisplayOps1<I>::drawXBitmap(lcdint_t x, lcdint_t y, lcduint_t w, lcduin
 {
     uint8_t i, j;
     lcduint_t pitch = (w + 7) >> 3;
-    this->m_intf.startBlock(x, y, w);
+    blockStart(x, y, w);
     for ( j = (h >> 3); j > 0; j-- )
     {
         uint8_t bit = 0;
@@ -454,7 +475,7 @@ void NanoDisplayOps1<I>::drawXBitmap(lcdint_t x, lcdint_t y, lcduint_t w, lcduin
             {
                 data |= (((pgm_read_byte(&bitmap[k * pitch]) >> bit) & 0x01) << k);
             }
-            this->m_intf.send(this->m_bgColor ^ data);
+            blockSend(this->m_bgColor ^ data);
             bit++;
             if ( bit >= 8 )
             {
@@ -467,9 +488,9 @@ void NanoDisplayOps1<I>::drawXBitmap(lcdint_t x, lcdint_t y, lcduint_t w, lcduin
             bitmap++;
         }
         bitmap += pitch * 7;
-        this->m_intf.nextBlock();
+        blockNext();
     }
-    this->m_intf.endBlock();
+    blockEnd();
 }
 
 template <class I>
@@ -514,7 +535,7 @@ void NanoDisplayOps1<I>::drawBitmap1(lcdint_t x, lcdint_t y, lcduint_t w, lcduin
     }
     pages = ((y + h - 1) >> 3) - (y >> 3) + 1;
 
-    this->m_intf.startBlock(x, y >> 3, w);
+    blockStart(x, y >> 3, w);
     for ( j = 0; j < pages; j++ )
     {
         if ( j == (lcduint_t)(max_pages - 1) )
@@ -531,13 +552,13 @@ void NanoDisplayOps1<I>::drawBitmap1(lcdint_t x, lcdint_t y, lcduint_t w, lcduin
                 data ^= 0x00;
             }
             bitmap++;
-            this->m_intf.send(this->m_bgColor ^ data);
+            blockSend(this->m_bgColor ^ data);
         }
         bitmap += origin_width - w;
         complexFlag = offset;
-        this->m_intf.nextBlock();
+        blockNext();
     }
-    this->m_intf.endBlock();
+    blockEnd();
 }
 
 template <class I>
@@ -583,7 +604,7 @@ void NanoDisplayOps1<I>::gfx_drawMonoBitmap(lcdint_t x, lcdint_t y, lcduint_t w,
     pages = ((y + h - 1) >> 3) - (y >> 3) + 1;
 
     uint8_t color = this->m_color ? 0xFF : 0x00;
-    this->m_intf.startBlock(x, y >> 3, w);
+    blockStart(x, y >> 3, w);
     for ( j = 0; j < pages; j++ )
     {
         if ( j == (lcduint_t)(max_pages - 1) )
@@ -596,13 +617,13 @@ void NanoDisplayOps1<I>::gfx_drawMonoBitmap(lcdint_t x, lcdint_t y, lcduint_t w,
             if ( complexFlag )
                 data |= ((pgm_read_byte(buf - origin_width) >> (8 - offset)) & color);
             buf++;
-            this->m_intf.send(this->m_bgColor ^ data);
+            blockSend(this->m_bgColor ^ data);
         }
         buf += origin_width - w;
         complexFlag = offset;
-        this->m_intf.nextBlock();
+        blockNext();
     }
-    this->m_intf.endBlock();
+    blockEnd();
 }
 
 template <class I>
@@ -665,7 +686,7 @@ void NanoDisplayOps1<I>::drawBuffer1(lcdint_t x, lcdint_t y, lcduint_t w, lcduin
     }
     pages = ((y + h - 1) >> 3) - (y >> 3) + 1;
 
-    this->m_intf.startBlock(x, y >> 3, w);
+    blockStart(x, y >> 3, w);
     for ( j = 0; j < pages; j++ )
     {
         if ( j == (lcduint_t)(max_pages - 1) )
@@ -678,27 +699,33 @@ void NanoDisplayOps1<I>::drawBuffer1(lcdint_t x, lcdint_t y, lcduint_t w, lcduin
             if ( complexFlag )
                 data |= ((*(buffer - origin_width) >> (8 - offset)) & this->m_color);
             buffer++;
-            this->m_intf.send(this->m_bgColor ^ data);
+            blockSend(this->m_bgColor ^ data);
         }
         buffer += origin_width - w;
         complexFlag = offset;
-        this->m_intf.nextBlock();
+        blockNext();
     }
-    this->m_intf.endBlock();
+    blockEnd();
 }
 
 template <class I>
 void NanoDisplayOps1<I>::drawBuffer1Fast(lcdint_t x, lcdint_t y, lcduint_t w, lcduint_t h, const uint8_t *buf)
 {
     uint8_t j;
-    this->m_intf.startBlock(x, y >> 3, w);
+    blockStart(x, y >> 3, w);
+    if ( !m_shadow && lcd_accelPageBurst(this->m_intf, x, w, 0) )
+    {
+        blockBuffer(buf, w * (h >> 3));
+        blockEnd();
+        return;
+    }
     for ( j = (h >> 3); j > 0; j-- )
     {
-        this->m_intf.sendBuffer(buf, w);
+        blockBuffer(buf, w);
         buf += w;
-        this->m_intf.nextBlock();
+        blockNext();
     }
-    this->m_intf.endBlock();
+    blockEnd();
 }
 
 template <class I>
@@ -722,14 +749,45 @@ void NanoDisplayOps1<I>::drawBuffer16(lcdint_t x, lcdint_t y, lcduint_t w, lcdui
 template <class I> void NanoDisplayOps1<I>::fill(uint16_t color)
 {
     color ^= this->m_bgColor;
-    this->m_intf.startBlock(0, 0, 0);
+    blockStart(0, 0, 0);
+    if ( !m_shadow && lcd_accelPageBurst(this->m_intf, 0, 0, 0) )
+    {
+        blockRepeat(color, this->m_w * (this->m_h >> 3));
+        blockEnd();
+        return;
+    }
     for ( lcduint_t m = (this->m_h >> 3); m > 0; m-- )
     {
-        for ( lcduint_t n = this->m_w; n > 0; n-- )
+        blockRepeat(color, this->m_w);
+        blockNext();
+    }
+    blockEnd();
+}
+
+template <class I> void NanoDisplayOps1<I>::setShadow(NanoShadow1 *shadow)
+{
+    m_shadow = shadow;
+    if ( m_shadow )
+    {
+        m_shadow->reset();
+    }
+}
+
+template <class I> void NanoDisplayOps1<I>::flush()
+{
+    if ( !m_shadow )
+    {
+        return;
+    }
+    for ( lcduint_t page = 0; page < m_shadow->pages(); page++ )
+    {
+        lcduint_t x, w;
+        const uint8_t *data = m_shadow->takeSpan(page, x, w);
+        if ( data )
         {
-            this->m_intf.send(color);
+            this->m_intf.startBlock(x, page, w);
+            this->m_intf.sendBuffer(data, w);
+            this->m_intf.endBlock();
         }
-        this->m_intf.nextBlock();
     }
-    this->m_intf.endBlock();
 }
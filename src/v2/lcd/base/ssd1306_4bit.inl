@@ -136,10 +136,7 @@ template <class I> void NanoDisplayOps4<I>::fillRect(lcdint_t x1, lcdint_t y1, l
             continue;
         }
         this->m_intf.send(left_byte);
-        for ( lcdint_t k = pair_start + 1; k < pair_end; k++ )
-        {
-            this->m_intf.send(full);
-        }
+        this->m_intf.sendRepeat(full, pair_end - pair_start - 1);
         this->m_intf.send(right_byte);
     }
     this->m_intf.endBlock();
@@ -149,11 +146,7 @@ template <class I> void NanoDisplayOps4<I>::fill(uint16_t color)
 {
     this->m_intf.startBlock(0, 0, 0);
     uint32_t count = (uint32_t)this->m_w * (uint32_t)this->m_h / 2;
-    while ( count > 0 )
-    {
-        this->m_intf.send(color);
-        count--;
-    }
+    this->m_intf.sendRepeat(color, count);
     this->m_intf.endBlock();
 }
 
@@ -366,21 +359,26 @@ void NanoDisplayOps4<I>::drawBuffer16(lcdint_t x, lcdint_t y, lcduint_t w, lcdui
     // NOT IMPLEMENTED
 }
 
-template <class I> uint8_t NanoDisplayOps4<I>::printChar(uint8_t c)
+template <class I> void NanoDisplayOps4<I>::printGlyph(const SCharInfo &info)
 {
-    uint16_t unicode = this->m_font->unicode16FromUtf8(c);
-    if ( unicode == SSD1306_MORE_CHARS_REQUIRED )
-        return 0;
-    SCharInfo char_info;
-    this->m_font->getCharBitmap(unicode, &char_info);
     uint8_t mode = this->m_textMode;
     for ( uint8_t i = 0; i < (this->m_fontStyle == STYLE_BOLD ? 2 : 1); i++ )
     {
-        this->drawBitmap1(this->m_cursorX + i, this->m_cursorY, char_info.width, char_info.height, char_info.glyph);
+        this->drawBitmap1(this->m_cursorX + i, this->m_cursorY, info.width, info.height, info.glyph);
         this->m_textMode |= CANVAS_MODE_TRANSPARENT;
     }
     this->m_textMode = mode;
-    this->m_cursorX += (lcdint_t)(char_info.width + char_info.spacing);
+    this->m_cursorX += (lcdint_t)(info.width + info.spacing);
+}
+
+template <class I> uint8_t NanoDisplayOps4<I>::printChar(uint8_t c)
+{
+    uint16_t unicode = this->m_font->unicode16FromUtf8(c);
+    if ( unicode == SSD1306_MORE_CHARS_REQUIRED )
+        return 0;
+    SCharInfo char_info;
+    this->m_font->getCharBitmap(unicode, &char_info);
+    printGlyph(char_info);
     if ( ((this->m_textMode & CANVAS_TEXT_WRAP_LOCAL) &&
           (this->m_cursorX > ((lcdint_t)this->m_w - (lcdint_t)this->m_font->getHeader().width))) ||
          ((this->m_textMode & CANVAS_TEXT_WRAP) &&
@@ -23,6 +23,7 @@
 */
 
 #include "lcd_hal/io.h"
+#include "canvas/internal/display_kernels.h"
 
 #if 0
 void    ssd1306_setRgbColor(uint8_t r, uint8_t g, uint8_t b)
@@ -103,10 +104,9 @@ template <class I> void NanoDisplayOps8<I>::putPixel(lcdint_t x, lcdint_t y)
 template <class I> void NanoDisplayOps8<I>::drawHLine(lcdint_t x1, lcdint_t y1, lcdint_t x2)
 {
     this->m_intf.startBlock(x1, y1, 0);
-    while ( x1 <= x2 )
+    if ( x1 <= x2 )
     {
-        this->m_intf.send(this->m_color);
-        x1++;
+        this->m_intf.sendRepeat(this->m_color, x2 - x1 + 1);
     }
     this->m_intf.endBlock();
 }
@@ -114,10 +114,9 @@ template <class I> void NanoDisplayOps8<I>::drawHLine(lcdint_t x1, lcdint_t y1,
 template <class I> void NanoDisplayOps8<I>::drawVLine(lcdint_t x1, lcdint_t y1, lcdint_t y2)
 {
     this->m_intf.startBlock(x1, y1, 1);
-    while ( y1 <= y2 )
+    if ( y1 <= y2 )
     {
-        this->m_intf.send(this->m_color);
-        y1++;
+        this->m_intf.sendRepeat(this->m_color, y2 - y1 + 1);
     }
     this->m_intf.endBlock();
 }
@@ -133,11 +132,8 @@ template <class I> void NanoDisplayOps8<I>::fillRect(lcdint_t x1, lcdint_t y1, l
         ssd1306_swap_data(x1, x2, lcdint_t);
     }
     this->m_intf.startBlock(x1, y1, x2 - x1 + 1);
-    uint32_t count = (x2 - x1 + 1) * (y2 - y1 + 1);
-    while ( count-- )
-    {
-        this->m_intf.send(this->m_color);
-    }
+    uint32_t count = (uint32_t)(x2 - x1 + 1) * (uint32_t)(y2 - y1 + 1);
+    this->m_intf.sendRepeat(this->m_color, count);
     this->m_intf.endBlock();
 }
 
@@ -145,15 +141,16 @@ template <class I> void NanoDisplayOps8<I>::fill(uint16_t color)
 {
     this->m_intf.startBlock(0, 0, 0);
     uint32_t count = (uint32_t)this->m_w * (uint32_t)this->m_h;
-    while ( count-- )
-    {
-        this->m_intf.send(color);
-    }
+    this->m_intf.sendRepeat(color, count);
     this->m_intf.endBlock();
 }
 
 template <class I> void NanoDisplayOps8<I>::clear()
 {
+    if ( lcd_accelClear(this->m_intf, 0, 0, this->m_w - 1, this->m_h - 1, 0) )
+    {
+        return;
+    }
     fill(0x00);
 }
 
@@ -166,32 +163,35 @@ void NanoDisplayOps8<I>::drawXBitmap(lcdint_t x, lcdint_t y, lcduint_t w, lcduin
 template <class I>
 void NanoDisplayOps8<I>::drawBitmap1(lcdint_t xpos, lcdint_t ypos, lcduint_t w, lcduint_t h, const uint8_t *bitmap)
 {
-    uint8_t bit = 1;
-    uint8_t blackColor = this->m_bgColor;
-    uint8_t color = this->m_color;
+    uint8_t buf[CONFIG_LCDGFX_SEND_CHUNK_SIZE];
+    uint8_t lut[DISPLAY_LUT1_SIZE(1)];
+    uint16_t len = 0;
+    display_lut1(lut, this->m_color, this->m_bgColor, 1);
     this->m_intf.startBlock(xpos, ypos, w);
-    while ( h-- )
+    for ( lcduint_t row = 0; row < h; row++ )
     {
-        lcduint_t wx = w;
-        while ( wx-- )
-        {
-            uint8_t data = pgm_read_byte(bitmap);
-            if ( data & bit )
-                this->m_intf.send(color);
-            else
-                this->m_intf.send(blackColor);
-            bitmap++;
-        }
-        bit <<= 1;
-        if ( bit == 0 )
+        const uint8_t *cols = bitmap + (row >> 3) * w;
+        for ( lcduint_t x = 0; x < w; x += 8 )
         {
-            bit = 1;
-        }
-        else
-        {
-            bitmap -= w;
+            uint8_t count = w - x < 8 ? w - x : 8;
+            uint8_t data[8] = {0};
+            for ( uint8_t i = 0; i < count; i++ )
+            {
+                data[i] = pgm_read_byte(cols + x + i);
+            }
+            if ( len + count * 1 > sizeof(buf) )
+            {
+                this->m_intf.sendBuffer(buf, len);
+                len = 0;
+            }
+            display_expand1(buf + len, data, count, row & 7, lut, 1);
+            len += count * 1;
         }
     }
+    if ( len )
+    {
+        this->m_intf.sendBuffer(buf, len);
+    }
     this->m_intf.endBlock();
 }
 
@@ -204,13 +204,24 @@ void NanoDisplayOps8<I>::drawBitmap4(lcdint_t x, lcdint_t y, lcduint_t w, lcduin
 template <class I>
 void NanoDisplayOps8<I>::drawBitmap8(lcdint_t x, lcdint_t y, lcduint_t w, lcduint_t h, const uint8_t *bitmap)
 {
+    uint8_t buf[CONFIG_LCDGFX_SEND_CHUNK_SIZE];
+    uint16_t len = 0;
     this->m_intf.startBlock(x, y, w);
-    uint32_t count = (w) * (h);
+    uint32_t count = (uint32_t)(w) * (h);
     while ( count-- )
     {
-        this->m_intf.send(pgm_read_byte(bitmap));
+        buf[len++] = pgm_read_byte(bitmap);
+        if ( len >= sizeof(buf) )
+        {
+            this->m_intf.sendBuffer(buf, len);
+            len = 0;
+        }
         bitmap++;
     }
+    if ( len )
+    {
+        this->m_intf.sendBuffer(buf, len);
+    }
     this->m_intf.endBlock();
 }
 
@@ -223,30 +234,20 @@ void NanoDisplayOps8<I>::drawBitmap16(lcdint_t x, lcdint_t y, lcduint_t w, lcdui
 template <class I>
 void NanoDisplayOps8<I>::drawBuffer1(lcdint_t xpos, lcdint_t ypos, lcduint_t w, lcduint_t h, const uint8_t *buffer)
 {
-    uint8_t bit = 1;
-    uint8_t blackColor = this->m_bgColor;
-    uint8_t color = this->m_color;
+    uint8_t buf[CONFIG_LCDGFX_SEND_CHUNK_SIZE];
+    uint8_t lut[DISPLAY_LUT1_SIZE(1)];
+    // whole groups of 8 pixels per chunk
+    const lcduint_t chunk = (sizeof(buf) / 1) & ~7;
+    display_lut1(lut, this->m_color, this->m_bgColor, 1);
     this->m_intf.startBlock(xpos, ypos, w);
-    while ( h-- )
+    for ( lcduint_t row = 0; row < h; row++ )
     {
-        lcduint_t wx = w;
-        while ( wx-- )
-        {
-            uint8_t data = *buffer;
-            if ( data & bit )
-                this->m_intf.send(color);
-            else
-                this->m_intf.send(blackColor);
-            buffer++;
-        }
-        bit <<= 1;
-        if ( bit == 0 )
-        {
-            bit = 1;
-        }
-        else
+        const uint8_t *cols = buffer + (row >> 3) * w;
+        for ( lcduint_t x = 0; x < w; x += chunk )
         {
-            buffer -= w;
+            lcduint_t len = w - x < chunk ? w - x : chunk;
+            display_row1(buf, cols + x, len, row & 7, lut, 1);
+            this->m_intf.sendBuffer(buf, len * 1);
         }
     }
     this->m_intf.endBlock();
@@ -268,11 +269,14 @@ template <class I>
 void NanoDisplayOps8<I>::drawBuffer8(lcdint_t x, lcdint_t y, lcduint_t w, lcduint_t h, const uint8_t *buffer)
 {
     this->m_intf.startBlock(x, y, w);
-    uint32_t count = (w) * (h);
-    while ( count-- )
+    uint32_t count = (uint32_t)(w) * (h);
+    while ( count )
     {
-        this->m_intf.send(*buffer);
-        buffer++;
+        /* sendBuffer() accepts up to 64KiB, so split large areas */
+        uint16_t len = count > 0x8000 ? 0x8000 : count;
+        this->m_intf.sendBuffer(buffer, len);
+        buffer += len;
+        count -= len;
     }
     this->m_intf.endBlock();
 }
@@ -283,21 +287,50 @@ void NanoDisplayOps8<I>::drawBuffer16(lcdint_t x, lcdint_t y, lcduint_t w, lcdui
     // NOT IMPLEMENTED
 }
 
-template <class I> uint8_t NanoDisplayOps8<I>::printChar(uint8_t c)
+template <class I> void NanoDisplayOps8<I>::setGlyphCache(NanoGlyphCache *cache)
+{
+    m_glyphCache = cache;
+    if ( m_glyphCache )
+    {
+        m_glyphCache->reset();
+    }
+}
+
+template <class I> void NanoDisplayOps8<I>::drawGlyph(lcdint_t x, lcdint_t y, const SCharInfo &info)
+{
+    const uint8_t *data = m_glyphCache ? m_glyphCache->get(info.glyph, info.width, info.height, this->m_color,
+                                                           this->m_bgColor, 1)
+                                       : nullptr;
+    if ( !data )
+    {
+        this->drawBitmap1(x, y, info.width, info.height, info.glyph);
+        return;
+    }
+    this->m_intf.startBlock(x, y, info.width);
+    this->m_intf.sendBuffer(data, info.width * info.height);
+    this->m_intf.endBlock();
+}
+
+template <class I> void NanoDisplayOps8<I>::printGlyph(const SCharInfo &info)
 {
-    uint16_t unicode = this->m_font->unicode16FromUtf8(c);
-    if ( unicode == SSD1306_MORE_CHARS_REQUIRED )
-        return 0;
-    SCharInfo char_info;
-    this->m_font->getCharBitmap(unicode, &char_info);
     uint8_t mode = this->m_textMode;
     for ( uint8_t i = 0; i < (this->m_fontStyle == STYLE_BOLD ? 2 : 1); i++ )
     {
-        this->drawBitmap1(this->m_cursorX + i, this->m_cursorY, char_info.width, char_info.height, char_info.glyph);
+        drawGlyph(this->m_cursorX + i, this->m_cursorY, info);
         this->m_textMode |= CANVAS_MODE_TRANSPARENT;
     }
     this->m_textMode = mode;
-    this->m_cursorX += (lcdint_t)(char_info.width + char_info.spacing);
+    this->m_cursorX += (lcdint_t)(info.width + info.spacing);
+}
+
+template <class I> uint8_t NanoDisplayOps8<I>::printChar(uint8_t c)
+{
+    uint16_t unicode = this->m_font->unicode16FromUtf8(c);
+    if ( unicode == SSD1306_MORE_CHARS_REQUIRED )
+        return 0;
+    SCharInfo char_info;
+    this->m_font->getCharBitmap(unicode, &char_info);
+    printGlyph(char_info);
     if ( ((this->m_textMode & CANVAS_TEXT_WRAP_LOCAL) &&
           (this->m_cursorX > ((lcdint_t)this->m_w - (lcdint_t)this->m_font->getHeader().width))) ||
          ((this->m_textMode & CANVAS_TEXT_WRAP) &&
@@ -517,11 +517,179 @@ void ssd1306_setFont6x8(const uint8_t * progmemFont)
 //
 /////////////////////////////////////////////////////////////////////////////////
 
+template <class O, class I> void NanoDisplayOps<O, I>::putPixel(lcdint_t x, lcdint_t y)
+{
+    if ( m_commands )
+    {
+        record(x, y, x, y);
+        return;
+    }
+    O::putPixel(x, y);
+}
+
 template <class O, class I> void NanoDisplayOps<O, I>::putPixel(const NanoPoint &p)
 {
     this->putPixel(p.x, p.y);
 }
 
+template <class O, class I> void NanoDisplayOps<O, I>::drawHLine(lcdint_t x1, lcdint_t y1, lcdint_t x2)
+{
+    if ( m_commands )
+    {
+        if ( x1 <= x2 )
+        {
+            record(x1, y1, x2, y1);
+        }
+        return;
+    }
+    O::drawHLine(x1, y1, x2);
+}
+
+template <class O, class I> void NanoDisplayOps<O, I>::drawVLine(lcdint_t x1, lcdint_t y1, lcdint_t y2)
+{
+    if ( m_commands )
+    {
+        if ( y1 <= y2 )
+        {
+            record(x1, y1, x1, y2);
+        }
+        return;
+    }
+    O::drawVLine(x1, y1, y2);
+}
+
+template <class O, class I> void NanoDisplayOps<O, I>::fillRect(lcdint_t x1, lcdint_t y1, lcdint_t x2, lcdint_t y2)
+{
+    if ( m_commands )
+    {
+        record(x1, y1, x2, y2);
+        return;
+    }
+    O::fillRect(x1, y1, x2, y2);
+}
+
+template <class O, class I> void NanoDisplayOps<O, I>::clear()
+{
+    if ( m_commands )
+    {
+        m_commands->reset();
+    }
+    O::clear();
+}
+
+template <class O, class I> void NanoDisplayOps<O, I>::fill(uint16_t color)
+{
+    if ( m_commands )
+    {
+        m_commands->reset();
+    }
+    O::fill(color);
+}
+
+template <class O, class I> void NanoDisplayOps<O, I>::setCommandList(NanoCommandList *commands)
+{
+    if ( m_commands )
+    {
+        replay();
+    }
+    m_commands = commands;
+    if ( m_commands )
+    {
+        m_commands->reset();
+    }
+}
+
+template <class O, class I> void NanoDisplayOps<O, I>::flush()
+{
+    if ( m_commands )
+    {
+        replay();
+    }
+    O::flush();
+}
+
+template <class O, class I> bool NanoDisplayOps<O, I>::setScrollArea(lcdint_t top, lcdint_t bottom)
+{
+    if ( top < 0 || top > bottom || bottom >= (lcdint_t)this->height() )
+    {
+        return false;
+    }
+    if ( !lcd_accelScroll(this->m_intf, top, bottom, top, 0) )
+    {
+        return false;
+    }
+    m_scrollTop = top;
+    m_scrollBottom = bottom;
+    m_scrollLine = top;
+    return true;
+}
+
+template <class O, class I> lcdint_t NanoDisplayOps<O, I>::scrollTo(lcdint_t line)
+{
+    if ( m_scrollBottom < 0 && !setScrollArea(0, this->height() - 1) )
+    {
+        return -1;
+    }
+    lcdint_t size = m_scrollBottom - m_scrollTop + 1;
+    line = m_scrollTop + ((line - m_scrollTop) % size + size) % size;
+    // Recorded commands address GDRAM rows, which are shown before scrolling
+    replayPending();
+    if ( !lcd_accelScroll(this->m_intf, m_scrollTop, m_scrollBottom, line, 0) )
+    {
+        return -1;
+    }
+    m_scrollLine = line;
+    return line;
+}
+
+template <class O, class I> lcdint_t NanoDisplayOps<O, I>::scrollUp(lcduint_t lines)
+{
+    lcdint_t exposed = m_scrollLine;
+    if ( scrollTo(m_scrollLine + (lcdint_t)(lines % this->height())) < 0 )
+    {
+        return -1;
+    }
+    return exposed;
+}
+
+template <class O, class I> lcdint_t NanoDisplayOps<O, I>::scrollDown(lcduint_t lines)
+{
+    return scrollTo(m_scrollLine - (lcdint_t)(lines % this->height()));
+}
+
+template <class O, class I> lcdint_t NanoDisplayOps<O, I>::scrolledY(lcdint_t y)
+{
+    if ( y < m_scrollTop || y > m_scrollBottom )
+    {
+        return y;
+    }
+    lcdint_t size = m_scrollBottom - m_scrollTop + 1;
+    return m_scrollTop + (y - m_scrollTop + m_scrollLine - m_scrollTop) % size;
+}
+
+template <class O, class I> void NanoDisplayOps<O, I>::record(lcdint_t x1, lcdint_t y1, lcdint_t x2, lcdint_t y2)
+{
+    if ( !m_commands->add(x1, y1, x2, y2, this->getColor()) )
+    {
+        replay();
+        m_commands->add(x1, y1, x2, y2, this->getColor());
+    }
+}
+
+template <class O, class I> void NanoDisplayOps<O, I>::replay()
+{
+    uint16_t color = this->getColor();
+    m_commands->optimize();
+    for ( uint16_t i = 0; i < m_commands->size(); i++ )
+    {
+        const SNanoFillCommand &c = m_commands->get(i);
+        this->setColor(c.color);
+        O::fillRect(c.x1, c.y1, c.x2, c.y2);
+    }
+    m_commands->reset();
+    this->setColor(color);
+}
+
 template <class O, class I> void NanoDisplayOps<O, I>::drawRect(lcdint_t x1, lcdint_t y1, lcdint_t x2, lcdint_t y2)
 {
     this->drawHLine(x1, y1, x2);
@@ -537,6 +705,13 @@ template <class O, class I> void NanoDisplayOps<O, I>::drawRect(const NanoRect &
 
 template <class O, class I> void NanoDisplayOps<O, I>::drawLine(lcdint_t x1, lcdint_t y1, lcdint_t x2, lcdint_t y2)
 {
+    // Recorded commands must keep drawing order, so hardware lines are used in direct mode only
+    if ( !m_commands && x1 != x2 && y1 != y2 &&
+         lcd_accelDrawLine(this->m_intf, x1, y1, x2, y2, this->m_color, 0) )
+    {
+        return;
+    }
+    // Pixels of the same row (column for steep lines) are sent as single run
     lcduint_t dx = x1 > x2 ? (x1 - x2) : (x2 - x1);
     lcduint_t dy = y1 > y2 ? (y1 - y2) : (y2 - y1);
     lcduint_t err = 0;
@@ -547,16 +722,22 @@ template <class O, class I> void NanoDisplayOps<O, I>::drawLine(lcdint_t x1, lcd
             ssd1306_swap_data(x1, x2, lcdint_t);
             ssd1306_swap_data(y1, y2, lcdint_t);
         }
+        lcdint_t start = y1;
         for ( ; y1 <= y2; y1++ )
         {
-            this->putPixel(x1, y1);
             err += dx;
             if ( err >= dy )
             {
                 err -= dy;
+                this->drawVLine(x1, start, y1);
+                start = y1 + 1;
                 x1 < x2 ? x1++ : x1--;
             }
         }
+        if ( start <= y2 )
+        {
+            this->drawVLine(x1, start, y2);
+        }
     }
     else
     {
@@ -565,19 +746,25 @@ template <class O, class I> void NanoDisplayOps<O, I>::drawLine(lcdint_t x1, lcd
             ssd1306_swap_data(x1, x2, lcdint_t);
             ssd1306_swap_data(y1, y2, lcdint_t);
         }
+        lcdint_t start = x1;
         for ( ; x1 <= x2; x1++ )
         {
-            this->putPixel(x1, y1);
             err += dy;
             if ( err >= dx )
             {
                 err -= dx;
+                this->drawHLine(start, y1, x1);
+                start = x1 + 1;
                 if ( y1 < y2 )
                     y1++;
                 else
                     y1--;
             }
         }
+        if ( start <= x2 )
+        {
+            this->drawHLine(start, y1, x2);
+        }
     }
 }
 
@@ -606,31 +793,106 @@ template <class O, class I> void NanoDisplayOps<O, I>::clearRect(const NanoRect
 
 template <class O, class I> void NanoDisplayOps<O, I>::drawCircle(lcdint_t xc, lcdint_t yc, lcdint_t r, uint8_t options)
 {
+    // Points with the same y form horizontal runs in the octants near top and bottom, and
+    // vertical runs in the octants near left and right sides. The run of y = r includes
+    // the cardinal points (x = 0).
     lcdint_t d = 3 - 2 * r;
     lcdint_t x = 0;
     lcdint_t y = r;
-    if (options & (2 + 4)) putPixel(xc, yc + r);
-    if (options & (1 + 8)) putPixel(xc, yc - r);
-    if (options & (1 + 2)) putPixel(xc + r, yc);
-    if (options & (4 + 8)) putPixel(xc - r, yc);
+    lcdint_t start = 0;
     while ( y >= x )
     {
         x++;
         if ( d > 0 )
         {
+            drawCircleRun(xc, yc, y, start, x - 1, options);
+            start = x;
             y--;
             d += -4 * y + 4;
         }
         d += 4 * x + 6;
-        if (options & (2)) putPixel(xc + x, yc + y);
-        if (options & (4)) putPixel(xc - x, yc + y);
-        if (options & (1)) putPixel(xc + x, yc - y);
-        if (options & (8)) putPixel(xc - x, yc - y);
-        if (options & (2)) putPixel(xc + y, yc + x);
-        if (options & (4)) putPixel(xc - y, yc + x);
-        if (options & (1)) putPixel(xc + y, yc - x);
-        if (options & (8)) putPixel(xc - y, yc - x);
     }
+    drawCircleRun(xc, yc, y, start, x, options);
+}
+
+template <class O, class I>
+void NanoDisplayOps<O, I>::drawCircleRun(lcdint_t xc, lcdint_t yc, lcdint_t y, lcdint_t xs, lcdint_t xe, uint8_t options)
+{
+    // Quadrants: 1 - top right, 2 - bottom right, 4 - bottom left, 8 - top left
+    // Runs of both quadrants are merged, if they touch at x = 0
+    bool merge = xs == 0;
+    if ( merge && (options & 6) == 6 )
+    {
+        this->drawHLine(xc - xe, yc + y, xc + xe);
+    }
+    else
+    {
+        if ( options & 2 )
+            this->drawHLine(xc + xs, yc + y, xc + xe);
+        if ( options & 4 )
+            this->drawHLine(xc - xe, yc + y, xc - xs);
+    }
+    if ( merge && (options & 9) == 9 )
+    {
+        this->drawHLine(xc - xe, yc - y, xc + xe);
+    }
+    else
+    {
+        if ( options & 1 )
+            this->drawHLine(xc + xs, yc - y, xc + xe);
+        if ( options & 8 )
+            this->drawHLine(xc - xe, yc - y, xc - xs);
+    }
+    if ( merge && (options & 3) == 3 )
+    {
+        this->drawVLine(xc + y, yc - xe, yc + xe);
+    }
+    else
+    {
+        if ( options & 2 )
+            this->drawVLine(xc + y, yc + xs, yc + xe);
+        if ( options & 1 )
+            this->drawVLine(xc + y, yc - xe, yc - xs);
+    }
+    if ( merge && (options & 12) == 12 )
+    {
+        this->drawVLine(xc - y, yc - xe, yc + xe);
+    }
+    else
+    {
+        if ( options & 4 )
+            this->drawVLine(xc - y, yc + xs, yc + xe);
+        if ( options & 8 )
+            this->drawVLine(xc - y, yc - xe, yc - xs);
+    }
+}
+
+template <class O, class I> void NanoDisplayOps<O, I>::fillCircle(lcdint_t xc, lcdint_t yc, lcdint_t r)
+{
+    nano_fillCircle(*this, xc, yc, r);
+}
+
+template <class O, class I>
+void NanoDisplayOps<O, I>::fillRoundRect(lcdint_t x1, lcdint_t y1, lcdint_t x2, lcdint_t y2, lcdint_t r)
+{
+    nano_fillRoundRect(*this, x1, y1, x2, y2, r);
+}
+
+template <class O, class I>
+void NanoDisplayOps<O, I>::fillTriangle(lcdint_t x1, lcdint_t y1, lcdint_t x2, lcdint_t y2, lcdint_t x3, lcdint_t y3)
+{
+    nano_fillTriangle(*this, x1, y1, x2, y2, x3, y3);
+}
+
+template <class O, class I> void NanoDisplayOps<O, I>::fillPolygon(const NanoPoint *points, uint8_t count)
+{
+    nano_fillPolygon(*this, points, count);
+}
+
+template <class O, class I>
+void NanoDisplayOps<O, I>::drawThickLine(lcdint_t x1, lcdint_t y1, lcdint_t x2, lcdint_t y2, lcduint_t width)
+{
+    nano_drawThickLine(*this, x1, y1, x2, y2, width);
 }
 
 template <class O, class I>
@@ -658,6 +920,27 @@ template <class O, class I> void NanoDisplayOps<O, I>::write(const char *str)
     }
 }
 
+template <class O, class I>
+lcdint_t NanoDisplayOps<O, I>::drawTextRun(lcdint_t x, lcdint_t y, const SGlyphRecord *glyphs, uint16_t count)
+{
+    replayPending();
+    lcdint_t cursorX = this->m_cursorX;
+    lcdint_t cursorY = this->m_cursorY;
+    this->m_cursorX = x;
+    this->m_cursorY = y;
+    for ( ; count; count--, glyphs++ )
+    {
+        if ( glyphs->unicode != '\n' )
+        {
+            this->printGlyph(glyphs->info);
+        }
+    }
+    x = this->m_cursorX;
+    this->m_cursorX = cursorX;
+    this->m_cursorY = cursorY;
+    return x;
+}
+
 template <class O, class I> void NanoDisplayOps<O, I>::print(int number)
 {
     char intStr[12];
@@ -861,6 +1144,123 @@ template <class O, class I> void NanoDisplayOps<O, I>::drawCanvas(lcdint_t x, lc
     this->drawBuffer16(x, y, canvas.width(), canvas.height(), canvas.getData());
 }
 
+template <class O, class I>
+void NanoDisplayOps<O, I>::drawBufferBits(lcdint_t x, lcdint_t y, lcduint_t w, lcduint_t h, const uint8_t *buf,
+                                          uint8_t bits)
+{
+    switch ( bits )
+    {
+        case 1: this->drawBuffer1Fast(x, y, w, h, buf); break;
+        case 4: this->drawBuffer4(x, y, w, h, buf); break;
+        case 8: this->drawBuffer8(x, y, w, h, buf); break;
+        default: this->drawBuffer16(x, y, w, h, buf); break;
+    }
+}
+
+template <class O, class I>
+void NanoDisplayOps<O, I>::drawBufferRect(lcdint_t x, lcdint_t y, lcduint_t w, const uint8_t *buf, uint8_t bits,
+                                          const NanoRect &rect)
+{
+    if ( rect.p1.x > rect.p2.x )
+    {
+        return;
+    }
+    lcdint_t x1 = rect.p1.x;
+    lcdint_t x2 = rect.p2.x;
+    if ( bits == 1 )
+    {
+        // 1-bit canvas is sent by pages, each page of the area needs own window anyway
+        for ( lcdint_t page = rect.p1.y >> 3; page <= (rect.p2.y >> 3); page++ )
+        {
+            drawBufferBits(x + x1, y + (page << 3), x2 - x1 + 1, 8, buf + page * w + x1, bits);
+        }
+        return;
+    }
+    if ( bits == 4 )
+    {
+        // Two pixels per byte
+        x1 &= ~1;
+        x2 |= 1;
+    }
+    lcduint_t stride = (uint32_t)w * bits / 8;
+    lcduint_t width = x2 - x1 + 1;
+    buf += rect.p1.y * stride + x1 * bits / 8;
+    if ( width == w )
+    {
+        drawBufferBits(x, y + rect.p1.y, w, rect.p2.y - rect.p1.y + 1, buf, bits);
+    }
+    else if ( bits == O::BITS_PER_PIXEL && bits != 4 )
+    {
+        // Native pixel format: stream rows of the area to a single window
+        this->m_intf.startBlock(x + x1, y + rect.p1.y, width);
+        for ( lcdint_t row = rect.p1.y; row <= rect.p2.y; row++ )
+        {
+            this->m_intf.sendBuffer(buf, width * bits / 8);
+            buf += stride;
+        }
+        this->m_intf.endBlock();
+    }
+    else
+    {
+        for ( lcdint_t row = rect.p1.y; row <= rect.p2.y; row++ )
+        {
+            drawBufferBits(x + x1, y + row, width, 1, buf, bits);
+            buf += stride;
+        }
+    }
+}
+
+template <class O, class I>
+void NanoDisplayOps<O, I>::drawBufferDiff(lcdint_t x, lcdint_t y, lcduint_t w, lcduint_t h, const uint8_t *buf,
+                                          uint8_t bits, NanoFrameDiff &diff)
+{
+    uint8_t *prev = diff.match(x, y, w, h, bits);
+    if ( !prev )
+    {
+        drawBufferBits(x, y, w, h, buf, bits);
+        diff.store(buf);
+        return;
+    }
+    // 1-bit canvas row is a page of 8 pixel rows, each byte is a column of the page
+    lcduint_t rows = bits == 1 ? (h >> 3) : h;
+    lcduint_t stride = bits == 1 ? w : (lcduint_t)((uint32_t)w * bits / 8);
+    uint8_t align = bits == 16 ? 2 : 1;
+    for ( lcduint_t row = 0; row < rows; row++ )
+    {
+        lcduint_t i = 0;
+        while ( i < stride )
+        {
+            if ( buf[i] == prev[i] )
+            {
+                i++;
+                continue;
+            }
+            lcduint_t start = i - i % align;
+            lcduint_t end = ++i;
+            for ( ; i < stride && i - end < CONFIG_LCDGFX_DIFF_MIN_GAP; i++ )
+            {
+                if ( buf[i] != prev[i] )
+                {
+                    end = i + 1;
+                }
+            }
+            end += (align - end % align) % align;
+            memcpy(prev + start, buf + start, end - start);
+            if ( bits == 1 )
+            {
+                drawBufferBits(x + start, y + (row << 3), end - start, 8, buf + start, bits);
+            }
+            else
+            {
+                drawBufferBits(x + start * 8 / bits, y + row, (end - start) * 8 / bits, 1, buf + start, bits);
+            }
+            i = end;
+        }
+        buf += stride;
+        prev += stride;
+    }
+}
+
 template <class O, class I> void NanoDisplayOps<O, I>::drawProgressBar(int8_t progress)
 {
     lcduint_t height = 8;
@@ -137,12 +137,25 @@ public:
      */
     void invertMode();
 
+    /**
+     * Hardware scrolling hook for NanoDisplayOps: defines vertical scrolling area (VSCRDEF)
+     * and sets scroll start address (VSCRSADD), so that top row of the area shows GDRAM
+     * row line. Supported in default orientation only.
+     *
+     * @param top first row of scrolling area
+     * @param bottom last row of scrolling area
+     * @param line GDRAM row to show at top row of the area, top <= line <= bottom
+     * @return true if commands are sent, false otherwise
+     */
+    bool accelScroll(lcdint_t top, lcdint_t bottom, lcdint_t line);
+
 private:
     const int8_t m_dc = -1;                            ///< data/command pin for SPI, -1 for i2c
     NanoDisplayBase<InterfaceILI9341<I>> &m_base; ///< basic lcd display support interface
     uint8_t m_rotation = 0x00;
     uint8_t m_rotate_output = 0x00;
     static const uint8_t m_rgb_bit = 0b00001000;
+    static const lcduint_t m_frameHeight = 320;       ///< lines in controller frame memory, native orientation
 };
 /**
  * Class implements basic functions for 16-bit mode of ILI9341-based displays
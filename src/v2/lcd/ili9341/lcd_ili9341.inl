@@ -139,6 +139,36 @@ template <class I> void InterfaceILI9341<I>::invertMode()
     this->stop();
 }
 
+template <class I> bool InterfaceILI9341<I>::accelScroll(lcdint_t top, lcdint_t bottom, lcdint_t line)
+{
+    if ( m_rotation != 0 || m_rotate_output )
+    {
+        return false;
+    }
+    // MY bit is set in default orientation, so row y is stored to frame memory line
+    // m_frameHeight - 1 - y, and the area is scrolled in the opposite direction in frame memory terms
+    lcduint_t tfa = m_frameHeight - 1 - bottom;
+    lcduint_t vsa = bottom - top + 1;
+    lcduint_t vsp = tfa + (vsa - (line - top)) % vsa;
+    this->start();
+    setDataMode(0);
+    this->send(0x33);
+    setDataMode(1);
+    this->send(tfa >> 8);
+    this->send(tfa & 0xFF);
+    this->send(vsa >> 8);
+    this->send(vsa & 0xFF);
+    this->send(top >> 8);
+    this->send(top & 0xFF);
+    setDataMode(0);
+    this->send(0x37);
+    setDataMode(1);
+    this->send(vsp >> 8);
+    this->send(vsp & 0xFF);
+    this->stop();
+    return true;
+}
+
 
 ////////////////////////////////////////////////////////////////////////////////
 //             ILI9341 basic 16-bit implementation
@@ -75,6 +75,47 @@ public:
      * @param data - byte to send
      */
     virtual void send(uint8_t data) = 0;
+
+    /**
+     * Sends bytes to display device. Override it if the device
+     * can transfer the whole buffer at once.
+     * @param buffer - bytes to send
+     * @param size - number of bytes to send
+     */
+    virtual void sendBuffer(const uint8_t *buffer, uint16_t size)
+    {
+        while ( size-- )
+        {
+            send(*buffer++);
+        }
+    }
+
+    /**
+     * Sends the same byte to display device count times
+     * @param data - byte to send
+     * @param count - number of times to send the byte
+     */
+    virtual void sendRepeat(uint8_t data, uint32_t count)
+    {
+        while ( count-- )
+        {
+            send(data);
+        }
+    }
+
+    /**
+     * Sends 16-bit value to display device count times, high byte first
+     * @param data - 16-bit value to send
+     * @param count - number of times to send the value
+     */
+    virtual void sendRepeat16(uint16_t data, uint32_t count)
+    {
+        while ( count-- )
+        {
+            send(data >> 8);
+            send(data & 0xFF);
+        }
+    }
 };
 
 /**
@@ -137,6 +178,36 @@ public:
         m_intf.send(data);
     }
 
+    /**
+     * Sends bytes to display device
+     * @param buffer - bytes to send
+     * @param size - number of bytes to send
+     */
+    void sendBuffer(const uint8_t *buffer, uint16_t size)
+    {
+        m_intf.sendBuffer(buffer, size);
+    }
+
+    /**
+     * Sends the same byte to display device count times
+     * @param data - byte to send
+     * @param count - number of times to send the byte
+     */
+    void sendRepeat(uint8_t data, uint32_t count)
+    {
+        m_intf.sendRepeat(data, count);
+    }
+
+    /**
+     * Sends 16-bit value to display device count times, high byte first
+     * @param data - 16-bit value to send
+     * @param count - number of times to send the value
+     */
+    void sendRepeat16(uint16_t data, uint32_t count)
+    {
+        m_intf.sendRepeat16(data, count);
+    }
+
 private:
     DisplayInterface &m_intf; ///< basic display communication interface
 };
@@ -100,6 +100,16 @@ public:
      */
     void commandStart();
 
+    /**
+     * Page burst hook for NanoDisplayOps: in horizontal addressing mode controller
+     * wraps to the next bank only after the last column of the screen.
+     *
+     * @param x start column of the block
+     * @param w width of the block, 0 means up to the right edge
+     * @return true if block covers whole width of the screen
+     */
+    bool accelPageBurst(lcduint_t x, lcduint_t w);
+
 private:
     const int8_t m_dc = -1;                       ///< data/command pin for SPI, -1 for i2c
     NanoDisplayBase<InterfacePCD8544<I>> &m_base; ///< basic lcd display support interface
@@ -79,6 +79,11 @@ template <class I> void InterfacePCD8544<I>::commandStart()
         this->send(0x00);
 }
 
+template <class I> bool InterfacePCD8544<I>::accelPageBurst(lcduint_t x, lcduint_t w)
+{
+    return x == 0 && (w == 0 || w == m_base.width());
+}
+
 
 ////////////////////////////////////////////////////////////////////////////////
 //             PCD8544 basic 1-bit implementation
@@ -46,8 +46,7 @@ template <class I> void InterfaceSH1106<I>::startBlock(lcduint_t x, lcduint_t y,
     }
     else
     {
-        this->stop();
-        this->start();
+        lcd_busRestart(*this, 0);
         this->send(0x40);
     }
 }
@@ -143,6 +142,16 @@ template <class I> void InterfaceSH1106<I>::flipVertical(uint8_t mode)
     this->stop();
 }
 
+template <class I> bool InterfaceSH1106<I>::accelScroll(lcdint_t top, lcdint_t bottom, lcdint_t line)
+{
+    if ( top != 0 || bottom != 63 || m_base.height() != 64 )
+    {
+        return false;
+    }
+    setStartLine(line);
+    return true;
+}
+
 
 ////////////////////////////////////////////////////////////////////////////////
 //             SH1106 basic 1-bit implementation
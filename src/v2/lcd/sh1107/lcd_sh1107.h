@@ -190,6 +190,17 @@ public:
      */
     void setDisplayOffset(uint8_t offset);
 
+    /**
+     * Hardware scrolling hook for NanoDisplayOps: sets start line, so that top row
+     * of the screen shows GDRAM row line. Only the whole screen of 128 rows is supported.
+     *
+     * @param top first row of scrolling area
+     * @param bottom last row of scrolling area
+     * @param line GDRAM row to show at top row of the area
+     * @return true if start line is set, false otherwise
+     */
+    bool accelScroll(lcdint_t top, lcdint_t bottom, lcdint_t line);
+
 private:
     int8_t m_dc = -1;                            ///< data/command pin for SPI, -1 for i2c
     NanoDisplayBase<InterfaceSH1107<I>> &m_base; ///< basic lcd display support interface
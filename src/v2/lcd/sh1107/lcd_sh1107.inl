@@ -46,8 +46,7 @@ template <class I> void InterfaceSH1107<I>::startBlock(lcduint_t x, lcduint_t y,
     }
     else
     {
-        this->stop();
-        this->start();
+        lcd_busRestart(*this, 0);
         this->send(0x40);
     }
 }
@@ -157,6 +156,16 @@ template <class I> void InterfaceSH1107<I>::setDisplayOffset(uint8_t offset)
     this->stop();
 }
 
+template <class I> bool InterfaceSH1107<I>::accelScroll(lcdint_t top, lcdint_t bottom, lcdint_t line)
+{
+    if ( top != 0 || bottom != 127 || m_base.height() != 128 )
+    {
+        return false;
+    }
+    setStartLine(line);
+    return true;
+}
+
 
 ////////////////////////////////////////////////////////////////////////////////
 //             SH1107 basic 1-bit implementation
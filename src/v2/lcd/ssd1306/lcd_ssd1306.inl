@@ -47,8 +47,7 @@ template <class I> void InterfaceSSD1306<I>::startBlock(lcduint_t x, lcduint_t y
     }
     else
     {
-        this->stop();
-        this->start();
+        lcd_busRestart(*this, 0);
         this->send(0x40);
     }
 }
@@ -143,6 +142,26 @@ template <class I> void InterfaceSSD1306<I>::flipVertical(uint8_t mode)
     this->stop();
 }
 
+template <class I> bool InterfaceSSD1306<I>::accelScroll(lcdint_t top, lcdint_t bottom, lcdint_t line)
+{
+    if ( top != 0 || bottom != 63 || m_base.height() != 64 )
+    {
+        return false;
+    }
+    setStartLine(line);
+    return true;
+}
+
+template <class I> bool InterfaceSSD1306<I>::accelPageBurst(lcduint_t x, lcduint_t w)
+{
+    // Valid for any block: init sequences select horizontal addressing mode (0x20, 0x00), and
+    // startBlock() sets column range x .. x + w - 1, so after the last column of the window
+    // the controller wraps to column x of the next page by itself
+    (void)x;
+    (void)w;
+    return true;
+}
+
 
 ////////////////////////////////////////////////////////////////////////////////
 //             SSD1306 basic 1-bit implementation
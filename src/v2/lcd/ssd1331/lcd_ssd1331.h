@@ -123,6 +123,9 @@ public:
      * @param x2 x position of second point
      * @param y2 y position of second point
      * @param color color to draw line with (refere RGB_COLOR16 macro)
+     *
+     * @note The controller is busy for some time after the command, next
+     *       command or data block is sent only after that time elapses.
      */
     void drawLine(lcdint_t x1, lcdint_t y1, lcdint_t x2, lcdint_t y2, uint16_t color);
 
@@ -138,13 +141,71 @@ public:
      *
      * @note This API can be used only with ssd1331 RGB oled displays
      * @note after copy command is sent, it takes some time from oled
-     *       controller to complete operation. So, it is highly recommended
-     *       to wait for reasonable time before send other graphics operations
-     *       (for example, use 250us delay). This time is required for
-     *       oled display to become ready to accept new commands.
+     *       controller to complete operation. If CONFIG_LCDGFX_ACCEL_NS_PER_PIXEL
+     *       is set, next command or data block is sent only after that time elapses.
      */
     void copyBlock(uint8_t left, uint8_t top, uint8_t right, uint8_t bottom, uint8_t newLeft, uint8_t newTop);
 
+    /**
+     * Fills rectangle using hardware accelerator capabilities
+     *
+     * @param x1 left position of rectangle
+     * @param y1 top position of rectangle
+     * @param x2 right position of rectangle
+     * @param y2 bottom position of rectangle
+     * @param color color to fill rectangle with (refere RGB_COLOR16 macro)
+     */
+    void fillRect(lcdint_t x1, lcdint_t y1, lcdint_t x2, lcdint_t y2, uint16_t color);
+
+    /**
+     * Clears rectangle in GDRAM using hardware accelerator capabilities
+     *
+     * @param x1 left position of rectangle
+     * @param y1 top position of rectangle
+     * @param x2 right position of rectangle
+     * @param y2 bottom position of rectangle
+     */
+    void clearBlock(lcdint_t x1, lcdint_t y1, lcdint_t x2, lcdint_t y2);
+
+    /**
+     * Hardware acceleration hook for NanoDisplayOps: fills rectangle with
+     * the controller command, if display works in 16-bit mode.
+     * Rectangles smaller than 4 pixels are cheaper to send as pixel data.
+     *
+     * @param x1 left position of rectangle
+     * @param y1 top position of rectangle
+     * @param x2 right position of rectangle, x2 >= x1
+     * @param y2 bottom position of rectangle, y2 >= y1
+     * @param color 16-bit color
+     * @return true if command is sent, false otherwise
+     */
+    bool accelFillRect(lcdint_t x1, lcdint_t y1, lcdint_t x2, lcdint_t y2, uint16_t color);
+
+    /**
+     * Hardware acceleration hook for NanoDisplayOps: clears rectangle with
+     * the controller command.
+     *
+     * @param x1 left position of rectangle
+     * @param y1 top position of rectangle
+     * @param x2 right position of rectangle, x2 >= x1
+     * @param y2 bottom position of rectangle, y2 >= y1
+     * @return true if command is sent, false otherwise
+     */
+    bool accelClear(lcdint_t x1, lcdint_t y1, lcdint_t x2, lcdint_t y2);
+
+    /**
+     * Hardware acceleration hook for NanoDisplayOps: draws line with
+     * the controller command, if display works in 16-bit mode.
+     *
+     * @param x1 x position of first point
+     * @param y1 y position of first point
+     * @param x2 x position of second point
+     * @param y2 y position of second point
+     * @param color 16-bit color
+     * @return true if command is sent, false otherwise
+     */
+    bool accelDrawLine(lcdint_t x1, lcdint_t y1, lcdint_t x2, lcdint_t y2, uint16_t color);
+
     /**
      * Set display contrast for all RGB channels uniformly.
      * Sets the same contrast value for Red, Green and Blue channels.
@@ -157,6 +218,43 @@ private:
     const int8_t m_dc = -1;                            ///< data/command pin for SPI, -1 for i2c
     NanoDisplayBase<InterfaceSSD1331<I>> &m_base; ///< basic lcd display support interface
     uint8_t m_rotation = 0x00;                         ///< Indicates display orientation: 0, 1, 2, 3. refer to setRotation
+    uint32_t m_busyTs = 0;                             ///< time of the last hardware accelerated command
+    uint32_t m_busyUs = 0;                             ///< time, the controller needs to complete the command
+
+    /**
+     * Marks the controller busy with hardware accelerated command.
+     * Does nothing, if CONFIG_LCDGFX_ACCEL_NS_PER_PIXEL is 0, and in SDL emulation,
+     * which completes commands at once.
+     * @param pixels number of pixels, the command changes
+     */
+    void setBusy(uint32_t pixels)
+    {
+#if CONFIG_LCDGFX_ACCEL_NS_PER_PIXEL > 0 && !defined(SDL_EMULATION)
+        m_busyTs = lcd_micros();
+        m_busyUs = pixels * CONFIG_LCDGFX_ACCEL_NS_PER_PIXEL / 1000 + 1;
+#else
+        (void)pixels;
+#endif
+    }
+
+    /**
+     * Waits until the controller completes last hardware accelerated command
+     */
+    void waitReady()
+    {
+        while ( m_busyUs && (uint32_t)(lcd_micros() - m_busyTs) < m_busyUs )
+        {
+        }
+        m_busyUs = 0;
+    }
+
+    /**
+     * Returns true if rectangle is inside GDRAM
+     */
+    bool isInside(lcdint_t x1, lcdint_t y1, lcdint_t x2, lcdint_t y2) const
+    {
+        return x1 >= 0 && y1 >= 0 && x2 < (lcdint_t)m_base.width() && y2 < (lcdint_t)m_base.height();
+    }
 };
 /**
  * Class implements basic functions for 8-bit mode of SSD1331-based displays
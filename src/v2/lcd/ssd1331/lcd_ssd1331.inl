@@ -34,6 +34,7 @@
 
 template <class I> void InterfaceSSD1331<I>::startBlock(lcduint_t x, lcduint_t y, lcduint_t w)
 {
+    waitReady();
     uint8_t rx = w ? (x + w - 1) : (m_base.width() - 1);
     this->start();
     setDataMode(0);
@@ -81,6 +82,7 @@ template <class I> void InterfaceSSD1331<I>::setRotation(uint8_t rotation)
         m_base.swapDimensions();
     }
     m_rotation = rotation & 0x03;
+    waitReady();
     this->start();
     setDataMode(0);
     this->send( 0xA0 );
@@ -107,6 +109,12 @@ template <class I> void InterfaceSSD1331<I>::setRotation(uint8_t rotation)
 
 template <class I> void InterfaceSSD1331<I>::drawLine(lcdint_t x1, lcdint_t y1, lcdint_t x2, lcdint_t y2, uint16_t color)
 {
+    waitReady();
+    if ( m_rotation & 1 )
+    {
+        ssd1306_swap_data(x1, y1, lcdint_t);
+        ssd1306_swap_data(x2, y2, lcdint_t);
+    }
     this->start();
     setDataMode(0);
     this->send( 0x21 );
@@ -118,10 +126,20 @@ template <class I> void InterfaceSSD1331<I>::drawLine(lcdint_t x1, lcdint_t y1,
     this->send( (color & 0x07E0) >> 5 );
     this->send( (color & 0x001F) << 1 );
     this->stop();
+    lcduint_t dx = x1 > x2 ? x1 - x2 : x2 - x1;
+    lcduint_t dy = y1 > y2 ? y1 - y2 : y2 - y1;
+    setBusy( (dx > dy ? dx : dy) + 1 );
 }
 
 template <class I> void InterfaceSSD1331<I>::copyBlock(uint8_t left, uint8_t top, uint8_t right, uint8_t bottom, uint8_t newLeft, uint8_t newTop)
 {
+    waitReady();
+    if ( m_rotation & 1 )
+    {
+        ssd1306_swap_data(left, top, uint8_t);
+        ssd1306_swap_data(right, bottom, uint8_t);
+        ssd1306_swap_data(newLeft, newTop, uint8_t);
+    }
     this->start();
     setDataMode(0);
     this->send(0x23);
@@ -132,6 +150,84 @@ template <class I> void InterfaceSSD1331<I>::copyBlock(uint8_t left, uint8_t top
     this->send(newLeft);
     this->send(newTop);
     this->stop();
+    setBusy( (uint32_t)(right - left + 1) * (bottom - top + 1) );
+}
+
+template <class I> void InterfaceSSD1331<I>::fillRect(lcdint_t x1, lcdint_t y1, lcdint_t x2, lcdint_t y2, uint16_t color)
+{
+    waitReady();
+    if ( m_rotation & 1 )
+    {
+        ssd1306_swap_data(x1, y1, lcdint_t);
+        ssd1306_swap_data(x2, y2, lcdint_t);
+    }
+    this->start();
+    setDataMode(0);
+    this->send( 0x26 ); // enable fill
+    this->send( 0x01 );
+    this->send( 0x22 );
+    this->send(x1);
+    this->send(y1);
+    this->send(x2);
+    this->send(y2);
+    // outline color, then fill color
+    for ( uint8_t i = 0; i < 2; i++ )
+    {
+        this->send( (color & 0xF800) >> 10 );
+        this->send( (color & 0x07E0) >> 5 );
+        this->send( (color & 0x001F) << 1 );
+    }
+    this->stop();
+    setBusy( (uint32_t)(x2 - x1 + 1) * (y2 - y1 + 1) );
+}
+
+template <class I> void InterfaceSSD1331<I>::clearBlock(lcdint_t x1, lcdint_t y1, lcdint_t x2, lcdint_t y2)
+{
+    waitReady();
+    if ( m_rotation & 1 )
+    {
+        ssd1306_swap_data(x1, y1, lcdint_t);
+        ssd1306_swap_data(x2, y2, lcdint_t);
+    }
+    this->start();
+    setDataMode(0);
+    this->send( 0x25 );
+    this->send(x1);
+    this->send(y1);
+    this->send(x2);
+    this->send(y2);
+    this->stop();
+    setBusy( (uint32_t)(x2 - x1 + 1) * (y2 - y1 + 1) );
+}
+
+template <class I> bool InterfaceSSD1331<I>::accelFillRect(lcdint_t x1, lcdint_t y1, lcdint_t x2, lcdint_t y2, uint16_t color)
+{
+    if ( m_bits != 16 || !isInside(x1, y1, x2, y2) || (uint32_t)(x2 - x1 + 1) * (y2 - y1 + 1) < 4 )
+    {
+        return false;
+    }
+    fillRect(x1, y1, x2, y2, color);
+    return true;
+}
+
+template <class I> bool InterfaceSSD1331<I>::accelClear(lcdint_t x1, lcdint_t y1, lcdint_t x2, lcdint_t y2)
+{
+    if ( !isInside(x1, y1, x2, y2) )
+    {
+        return false;
+    }
+    clearBlock(x1, y1, x2, y2);
+    return true;
+}
+
+template <class I> bool InterfaceSSD1331<I>::accelDrawLine(lcdint_t x1, lcdint_t y1, lcdint_t x2, lcdint_t y2, uint16_t color)
+{
+    if ( m_bits != 16 || !isInside(x1 < x2 ? x1 : x2, y1 < y2 ? y1 : y2, x1 < x2 ? x2 : x1, y1 < y2 ? y2 : y1) )
+    {
+        return false;
+    }
+    drawLine(x1, y1, x2, y2, color);
+    return true;
 }
 
 template <class I> void InterfaceSSD1331<I>::setContrast(uint8_t contrast)
@@ -185,6 +185,35 @@ template <class I> void InterfaceST7789<I>::invertMode()
     this->stop();
 }
 
+template <class I> bool InterfaceST7789<I>::accelScroll(lcdint_t top, lcdint_t bottom, lcdint_t line)
+{
+    lcduint_t tfa = top + m_offset_y;
+    lcduint_t vsa = bottom - top + 1;
+    if ( m_rotation != 0 || tfa + vsa > 320 )
+    {
+        return false;
+    }
+    lcduint_t vsp = line + m_offset_y;
+    lcduint_t bfa = 320 - tfa - vsa;
+    this->start();
+    setDataMode(0);
+    this->send(0x33);
+    setDataMode(1);
+    this->send(tfa >> 8);
+    this->send(tfa & 0xFF);
+    this->send(vsa >> 8);
+    this->send(vsa & 0xFF);
+    this->send(bfa >> 8);
+    this->send(bfa & 0xFF);
+    setDataMode(0);
+    this->send(0x37);
+    setDataMode(1);
+    this->send(vsp >> 8);
+    this->send(vsp & 0xFF);
+    this->stop();
+    return true;
+}
+
 
 ////////////////////////////////////////////////////////////////////////////////
 //             ST7789 basic 16-bit implementation
@@ -94,6 +94,17 @@ public:
     {
     }
 
+    /**
+     * Returns true if area, occupied by the object, intersects specified rectangle.
+     * Override it, if the object draws outside of its rectangle.
+     *
+     * @param rect area in global (World) coordinates
+     */
+    bool intersects(const NanoRect &rect) const override
+    {
+        return m_rect.overlaps(rect);
+    }
+
     /**
      * Returns width of NanoObject
      */
@@ -302,15 +313,29 @@ public:
         }
     }
 
+    /**
+     * List of objects can draw anywhere, since its own rectangle doesn't
+     * cover the objects in the list.
+     */
+    bool intersects(const NanoRect &rect) const override
+    {
+        (void)(rect);
+        return true;
+    }
+
     /**
      * Draw all objects from the list in the buffer.
+     * Objects outside the area, being updated by the engine, are skipped.
      */
     void draw() override
     {
         NanoObject<T> *p = getNext();
         while ( p )
         {
-            p->draw();
+            if ( !this->hasTiler() || p->intersects(this->getTiler().getDrawRect()) )
+            {
+                p->draw();
+            }
             p = getNext(p);
         }
     }
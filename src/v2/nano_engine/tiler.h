@@ -37,9 +37,23 @@
  * @{
  */
 
-#ifndef NE_MAX_TILE_ROWS
-#define NE_MAX_TILE_ROWS 20 ///< Maximum tile rows supported. Can be defined outside the library
+#ifndef NE_MAX_DISPLAY_WIDTH
+#if defined(__AVR__)
+#define NE_MAX_DISPLAY_WIDTH 128 ///< Maximum display width in pixels supported. Can be defined outside the library
+#else
+#define NE_MAX_DISPLAY_WIDTH 320 ///< Maximum display width in pixels supported. Can be defined outside the library
 #endif
+#endif
+
+#ifndef NE_MAX_DISPLAY_HEIGHT
+#if defined(__AVR__)
+#define NE_MAX_DISPLAY_HEIGHT 160 ///< Maximum display height in pixels supported. Can be defined outside the library
+#else
+#define NE_MAX_DISPLAY_HEIGHT 320 ///< Maximum display height in pixels supported. Can be defined outside the library
+#endif
+#endif
+
+/* NE_MAX_TILE_ROWS can still be defined outside the library to override number of tile rows */
 
 /**
  * Structure, holding currently set font.
@@ -106,6 +120,19 @@ public:
      */
     virtual void refresh() = 0;
 
+    /**
+     * Returns true if object can draw something inside specified area.
+     * NanoEngine calls draw() only for objects, which intersect the tile being updated.
+     * Default implementation returns true, so the object is drawn for every tile.
+     *
+     * @param rect area in global (World) coordinates
+     */
+    virtual bool intersects(const NanoRect &rect) const
+    {
+        (void)(rect);
+        return true;
+    }
+
     /**
      * Sets logic focus on NanoEngineObject
      */
@@ -151,8 +178,9 @@ public:
     }
 
 protected:
-    T *m_tiler = nullptr;                  ///< Active tiler, assigned to the NanoEngineObject
-    NanoEngineObject<T> *m_next = nullptr; ///< Next NanoEngineObject in the list
+    T *m_tiler = nullptr;                       ///< Active tiler, assigned to the NanoEngineObject
+    NanoEngineObject<T> *m_next = nullptr;      ///< Next NanoEngineObject in the list
+    NanoEngineObject<T> *m_nextInRow = nullptr; ///< Next NanoEngineObject, crossing tile row being updated
 
     /**
      * Bind NanoEngineObject to specific NanoEngine
@@ -168,6 +196,153 @@ private:
     bool m_focused = false;
 };
 
+/**
+ * Provides tile size of canvas class C at compile time.
+ * Canvas classes without compile-time size are considered to be 8x8 tiles,
+ * the smallest standard tile size.
+ */
+template <class C> struct NanoEngineTileSize
+{
+    static const uint16_t WIDTH = 8;  ///< tile width in pixels
+    static const uint16_t HEIGHT = 8; ///< tile height in pixels
+};
+
+/**
+ * Provides tile size of NanoCanvas<W, H, BPP> at compile time.
+ */
+template <lcduint_t W, lcduint_t H, uint8_t BPP> struct NanoEngineTileSize<NanoCanvas<W, H, BPP>>
+{
+    static const uint16_t WIDTH = W;  ///< tile width in pixels
+    static const uint16_t HEIGHT = H; ///< tile height in pixels
+};
+
+/**
+ * Bitmap of tiles to be refreshed. Each row of tiles is stored as array of bytes,
+ * bit N of byte K corresponds to the tile column K * 8 + N.
+ *
+ * @tparam ROWS maximum number of tile rows
+ * @tparam COLUMNS maximum number of tile columns
+ */
+template <uint16_t ROWS, uint16_t COLUMNS> class NanoEngineDirtyMap
+{
+public:
+    /** Number of bytes, holding single row of tiles */
+    static const uint16_t ROW_BYTES = (COLUMNS + 7) / 8;
+
+    /**
+     * Marks all tiles as dirty
+     */
+    void setAll()
+    {
+        memset(m_bits, 0xFF, sizeof(m_bits));
+    }
+
+    /**
+     * Marks tile as dirty. Tiles outside the map are ignored.
+     * @param column tile column
+     * @param row tile row
+     */
+    void set(uint16_t column, uint16_t row)
+    {
+        if ( column < COLUMNS && row < ROWS )
+        {
+            m_bits[row][column >> 3] |= (1 << (column & 7));
+        }
+    }
+
+    /**
+     * Marks rectangular area of tiles as dirty. Area is clipped to the map size.
+     * @param column1 left tile column
+     * @param row1 top tile row
+     * @param column2 right tile column (inclusive)
+     * @param row2 bottom tile row (inclusive)
+     */
+    void setRect(uint16_t column1, uint16_t row1, uint16_t column2, uint16_t row2)
+    {
+        if ( column1 >= COLUMNS || row1 >= ROWS )
+        {
+            return;
+        }
+        column2 = lcd_gfx_min(column2, (uint16_t)(COLUMNS - 1));
+        row2 = lcd_gfx_min(row2, (uint16_t)(ROWS - 1));
+        for ( uint16_t row = row1; row <= row2; row++ )
+        {
+            for ( uint16_t column = column1; column <= column2; column++ )
+            {
+                m_bits[row][column >> 3] |= (1 << (column & 7));
+            }
+        }
+    }
+
+    /**
+     * Copies state of tiles row to the buffer and marks all tiles in the row as clean.
+     * @param row tile row
+     * @param out buffer of ROW_BYTES bytes
+     * @return true if there is at least one dirty tile in the row
+     */
+    bool takeRow(uint16_t row, uint8_t *out)
+    {
+        uint8_t any = 0;
+        for ( uint16_t i = 0; i < ROW_BYTES; i++ )
+        {
+            any |= m_bits[row][i];
+            out[i] = m_bits[row][i];
+            m_bits[row][i] = 0;
+        }
+        return any != 0;
+    }
+
+    /**
+     * Searches for next span of dirty tiles in the row, returned by takeRow().
+     * @param row bitmap of tiles row
+     * @param column [in] column to start search from, [out] first column of found span
+     * @param count [out] number of dirty tiles in found span
+     * @return false if there are no more dirty tiles in the row
+     */
+    static bool nextSpan(const uint8_t *row, uint16_t &column, uint16_t &count)
+    {
+        // Skip clean tiles, whole bytes at once
+        while ( column < COLUMNS && !(row[column >> 3] >> (column & 7)) )
+        {
+            column = (column | 7) + 1;
+        }
+        if ( column >= COLUMNS )
+        {
+            return false;
+        }
+        while ( !(row[column >> 3] & (1 << (column & 7))) )
+        {
+            column++;
+        }
+        if ( column >= COLUMNS )
+        {
+            return false;
+        }
+        uint16_t end = column + 1;
+        while ( end < COLUMNS )
+        {
+            uint8_t bits = row[end >> 3];
+            if ( !(end & 7) && bits == 0xFF )
+            {
+                end += 8;
+            }
+            else if ( bits & (1 << (end & 7)) )
+            {
+                end++;
+            }
+            else
+            {
+                break;
+            }
+        }
+        count = lcd_gfx_min(end, COLUMNS) - column;
+        return true;
+    }
+
+private:
+    uint8_t m_bits[ROWS][ROW_BYTES]{};
+};
+
 /**
  * This class template is responsible for holding and updating data about areas to be refreshed
  * on LCD display. It accepts canvas class, tile width in pixels, tile height in pixels and
@@ -187,6 +362,8 @@ protected:
         , offset{0, 0}
         , m_first(nullptr)
     {
+        m_tileBuffer = canvas.getData();
+        m_tileWidth = canvas.width();
         refresh();
     };
 
@@ -195,12 +372,30 @@ public:
      * This type is template argument for all Nano Objects.
      */
     typedef NanoEngineTiler<C, D> TilerT;
+
+    /** Tile width in pixels, known at compile time */
+    static const uint16_t TILE_WIDTH = NanoEngineTileSize<C>::WIDTH;
+
+    /** Tile height in pixels, known at compile time */
+    static const uint16_t TILE_HEIGHT = NanoEngineTileSize<C>::HEIGHT;
+
+    /** Maximum number of tile columns, supported by the engine */
+    static const uint16_t TILE_COLUMNS = (NE_MAX_DISPLAY_WIDTH + TILE_WIDTH - 1) / TILE_WIDTH;
+
+#ifdef NE_MAX_TILE_ROWS
+    /** Maximum number of tile rows, supported by the engine */
+    static const uint16_t TILE_ROWS = NE_MAX_TILE_ROWS;
+#else
+    /** Maximum number of tile rows, supported by the engine */
+    static const uint16_t TILE_ROWS = (NE_MAX_DISPLAY_HEIGHT + TILE_HEIGHT - 1) / TILE_HEIGHT;
+#endif
+
     /**
      * Marks all tiles for update. Actual update will take place in display() method.
      */
     void refresh()
     {
-        memset(m_refreshFlags, 0xFF, sizeof(m_refreshFlags));
+        m_refreshFlags.setAll();
     }
 
     /**
@@ -219,9 +414,9 @@ public:
      */
     void refresh(const NanoPoint &point) __attribute__((noinline))
     {
-        if ( (point.x < 0) || (point.y < 0) || ((point.y / canvas.height()) >= NE_MAX_TILE_ROWS) )
+        if ( (point.x < 0) || (point.y < 0) )
             return;
-        m_refreshFlags[(point.y / canvas.height())] |= (1 << (point.x / canvas.width()));
+        m_refreshFlags.set(point.x / canvas.width(), point.y / canvas.height());
     }
 
     /**
@@ -236,15 +431,7 @@ public:
             y1 = 0;
         if ( x1 < 0 )
             x1 = 0;
-        y1 = y1 / canvas.height();
-        y2 = lcd_gfx_min((y2 / canvas.height()), NE_MAX_TILE_ROWS - 1);
-        for ( uint8_t x = x1 / canvas.width(); x <= (x2 / canvas.width()); x++ )
-        {
-            for ( uint8_t y = y1; y <= y2; y++ )
-            {
-                m_refreshFlags[y] |= (1 << x);
-            }
-        }
+        m_refreshFlags.setRect(x1 / canvas.width(), y1 / canvas.height(), x2 / canvas.width(), y2 / canvas.height());
     }
 
     /**
@@ -435,6 +622,37 @@ public:
         return m_display;
     }
 
+    /**
+     * Enables merging of adjacent dirty tiles in a row into single strip. The strip is drawn
+     * at once and sent to the display as one block, so the display window is set up once per
+     * strip instead of once per tile. Draw callback and objects are called once per strip,
+     * use getCanvas().width() to find out the width of the area being drawn.
+     * The buffer must hold width x tile height pixels, i.e.
+     * width * tile height * bits per pixel / 8 bytes.
+     *
+     * @code{.cpp}
+     * static uint8_t strip[320 * 16 * 2];
+     * engine.setStripBuffer(strip, 320); // NanoEngine16 with 16x16 tiles
+     * @endcode
+     *
+     * @param buffer memory for the strip, nullptr disables merging of tiles
+     * @param width strip width in pixels, rounded down to tile width
+     */
+    void setStripBuffer(uint8_t *buffer, lcduint_t width)
+    {
+        m_stripTiles = buffer ? width / m_tileWidth : 0;
+        m_strip = m_stripTiles ? buffer : nullptr;
+    }
+
+    /**
+     * Returns area in global (World) coordinates, which is being updated by the engine
+     * at the moment. Objects can use it to skip drawing of invisible parts.
+     */
+    const NanoRect &getDrawRect() const
+    {
+        return m_drawRect;
+    }
+
 protected:
     /**
      * Reference to display object, used by NanoEngine
@@ -446,9 +664,8 @@ protected:
 
     /**
      * Contains information on tiles to be updated.
-     * Elements of array are rows and bits are columns.
      */
-    uint16_t m_refreshFlags[NE_MAX_TILE_ROWS];
+    NanoEngineDirtyMap<TILE_ROWS, TILE_COLUMNS> m_refreshFlags;
 
     /**
      * @brief refreshes content on oled display.
@@ -473,46 +690,148 @@ private:
 
     NanoEngineObject<TilerT> *m_first = nullptr;
 
+    /** First object, crossing tile row being updated */
+    NanoEngineObject<TilerT> *m_firstInRow = nullptr;
+
+    /** Area being updated in World coordinates */
+    NanoRect m_drawRect{};
+
+    /** Tile buffer of the canvas */
+    uint8_t *m_tileBuffer = nullptr;
+
+    /** Buffer for merged tiles, nullptr if merging is disabled */
+    uint8_t *m_strip = nullptr;
+
+    /** Tile width in pixels */
+    lcduint_t m_tileWidth = 0;
+
+    /** Maximum number of tiles in the strip */
+    uint16_t m_stripTiles = 0;
+
+    /**
+     * Takes next portion of tiles from the span of dirty tiles: single tile or, if strip
+     * buffer is set, up to m_stripTiles tiles. Canvas is set up to cover the portion.
+     *
+     * @param column [in,out] first column of the span, moved to the next portion
+     * @param count [in,out] number of tiles left in the span
+     * @param x [out] position of the portion in pixels
+     * @return false if there is nothing to draw in the span
+     */
+    bool nextChunk(uint16_t &column, uint16_t &count, lcduint_t &x)
+    {
+        x = column * m_tileWidth;
+        if ( !count )
+        {
+            return false;
+        }
+        if ( x >= m_display.width() )
+        {
+            column = TILE_COLUMNS; // stop searching for spans in the row
+            return false;
+        }
+        uint16_t tiles = 1;
+        if ( m_strip )
+        {
+            tiles = lcd_gfx_min(count, m_stripTiles);
+            tiles = lcd_gfx_min(tiles, (uint16_t)((m_display.width() - x + m_tileWidth - 1) / m_tileWidth));
+            canvas.setBuffer(tiles * m_tileWidth, canvas.height(), m_strip);
+        }
+        column += tiles;
+        count -= tiles;
+        return true;
+    }
+
+    /**
+     * Switches canvas back to tile buffer after drawing of strips
+     */
+    void endStrips()
+    {
+        if ( m_strip )
+        {
+            canvas.setBuffer(m_tileWidth, canvas.height(), m_tileBuffer);
+        }
+    }
+
+    /**
+     * Collects objects, which intersect the row of tiles, to the list m_firstInRow,
+     * so drawing of each tile checks only objects from that row.
+     */
+    void selectRowObjects(lcduint_t y) __attribute__((noinline))
+    {
+        NanoRect row = {{(lcdint_t)(offset.x), (lcdint_t)(y + offset.y)},
+                        {(lcdint_t)(offset.x + m_display.width() - 1), (lcdint_t)(y + offset.y + canvas.height() - 1)}};
+        NanoEngineObject<TilerT> **last = &m_firstInRow;
+        for ( NanoEngineObject<TilerT> *p = m_first; p; p = p->m_next )
+        {
+            if ( p->intersects(row) )
+            {
+                *last = p;
+                last = &p->m_nextInRow;
+            }
+        }
+        *last = nullptr;
+    }
+
+    /**
+     * Sets position of the tile to update and returns true if user callback
+     * allows to update it.
+     */
+    bool beginTile(lcduint_t x, lcduint_t y)
+    {
+        canvas.setOffset(x + offset.x, y + offset.y);
+        m_drawRect = {{(lcdint_t)(x + offset.x), (lcdint_t)(y + offset.y)},
+                      {(lcdint_t)(x + offset.x + canvas.width() - 1), (lcdint_t)(y + offset.y + canvas.height() - 1)}};
+        if ( m_onDraw == nullptr )
+        {
+            canvas.clear();
+            return true;
+        }
+        return m_onDraw();
+    }
+
     void draw() __attribute__((noinline))
     {
-        NanoEngineObject<TilerT> *p = m_first;
-        while ( p )
+        for ( NanoEngineObject<TilerT> *p = m_firstInRow; p; p = p->m_nextInRow )
         {
-            p->draw();
-            p = p->m_next;
+            if ( p->intersects(m_drawRect) )
+            {
+                p->draw();
+            }
         }
     }
 };
 
 template <class C, class D> void NanoEngineTiler<C, D>::displayBuffer()
 {
-    //    printf("--------------\n");
-    for ( lcduint_t y = 0; y < m_display.height(); y = y + canvas.height() )
-    {
-        uint16_t flag = m_refreshFlags[y / canvas.height()];
-        m_refreshFlags[y / canvas.height()] = 0;
-        //        printf("|%d%d%d%d%d%d%d%d|\n", flag & 1, (flag >> 1) & 1, (flag >> 2) & 1, (flag >> 3) & 1, (flag >>
-        //        4) & 1, (flag >> 5) & 1,(flag >> 6) & 1,(flag >> 7) & 1 );
-        for ( lcduint_t x = 0; x < m_display.width(); x = x + canvas.width() )
+    uint8_t row[NanoEngineDirtyMap<TILE_ROWS, TILE_COLUMNS>::ROW_BYTES];
+    for ( uint16_t ty = 0; ty < TILE_ROWS; ty++ )
+    {
+        lcduint_t y = ty * canvas.height();
+        if ( y >= m_display.height() )
         {
-            if ( flag & 0x01 )
+            break;
+        }
+        if ( !m_refreshFlags.takeRow(ty, row) )
+        {
+            continue;
+        }
+        selectRowObjects(y);
+        uint16_t tx = 0;
+        uint16_t count;
+        while ( NanoEngineDirtyMap<TILE_ROWS, TILE_COLUMNS>::nextSpan(row, tx, count) )
+        {
+            lcduint_t x;
+            while ( nextChunk(tx, count, x) )
             {
-                canvas.setOffset(x + offset.x, y + offset.y);
-                if ( m_onDraw == nullptr )
-                {
-                    canvas.clear();
-                    draw();
-                    this->m_display.drawCanvas(x, y, canvas);
-                }
-                else if ( m_onDraw() )
+                if ( beginTile(x, y) )
                 {
                     draw();
                     this->m_display.drawCanvas(x, y, canvas);
                 }
             }
-            flag >>= 1;
         }
     }
+    endStrips();
 }
 
 template <class C, class D> void NanoEngineTiler<C, D>::displayPopup(const char *msg)
@@ -525,21 +844,27 @@ template <class C, class D> void NanoEngineTiler<C, D>::displayPopup(const char
     // TODO: It would be nice to calculate message height
     NanoPoint textPos = {(m_display.width() - (lcdint_t)width) >> 1, (m_display.height() - height) >> 1};
     refresh(rect);
-    for ( lcduint_t y = 0; y < m_display.height(); y = y + canvas.height() )
+    uint8_t row[NanoEngineDirtyMap<TILE_ROWS, TILE_COLUMNS>::ROW_BYTES];
+    for ( uint16_t ty = 0; ty < TILE_ROWS; ty++ )
     {
-        uint16_t flag = m_refreshFlags[y / canvas.height()];
-        m_refreshFlags[y / canvas.height()] = 0;
-        for ( lcduint_t x = 0; x < m_display.width(); x = x + canvas.width() )
+        lcduint_t y = ty * canvas.height();
+        if ( y >= m_display.height() )
+        {
+            break;
+        }
+        if ( !m_refreshFlags.takeRow(ty, row) )
         {
-            if ( flag & 0x01 )
+            continue;
+        }
+        selectRowObjects(y);
+        uint16_t tx = 0;
+        uint16_t count;
+        while ( NanoEngineDirtyMap<TILE_ROWS, TILE_COLUMNS>::nextSpan(row, tx, count) )
+        {
+            lcduint_t x;
+            while ( nextChunk(tx, count, x) )
             {
-                canvas.setOffset(x + offset.x, y + offset.y);
-                if ( !m_onDraw )
-                {
-                    canvas.clear();
-                    draw();
-                }
-                else if ( m_onDraw() )
+                if ( beginTile(x, y) )
                 {
                     draw();
                 }
@@ -552,9 +877,9 @@ template <class C, class D> void NanoEngineTiler<C, D>::displayPopup(const char
 
                 m_display.drawCanvas(x, y, canvas);
             }
-            flag >>= 1;
         }
     }
+    endStrips();
 }
 
 /**
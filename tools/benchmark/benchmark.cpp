@@ -0,0 +1,330 @@
+/*
+    MIT License
+
+    Copyright (c) 2026, Alexey Dynda
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+/**
+ * Microbenchmark for canvas and display primitives.
+ *
+ * Display primitives are measured against null bus, so the numbers show cost of
+ * the library code only, not of the hardware transfers. Bus calls and bytes per
+ * frame (total, command and data) are reported via CountingBus.
+ *
+ *   benchmark [-f filter] [-s baseline.txt] [-c baseline.txt] [-t percent]
+ *
+ *   -f  run only cases, which names contain filter string
+ *   -s  save results as new baseline
+ *   -c  compare results with saved baseline, exit code is 1 if any case
+ *       is slower than baseline by more than threshold
+ *   -t  regression threshold in percents (10 by default)
+ */
+
+#include "lcdgfx.h"
+
+#include <chrono>
+#include <map>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <string.h>
+#include <vector>
+
+/** Minimum time to run single case, in milliseconds */
+#ifndef CONFIG_BENCHMARK_CASE_MS
+#define CONFIG_BENCHMARK_CASE_MS 100
+#endif
+
+/**
+ * Bus, which drops all data
+ */
+class NullBus
+{
+public:
+    void begin()
+    {
+    }
+
+    void end()
+    {
+    }
+
+    void start()
+    {
+    }
+
+    void stop()
+    {
+    }
+
+    void send(uint8_t data)
+    {
+        m_sink = data;
+    }
+
+    void sendBuffer(const uint8_t *buffer, uint16_t size)
+    {
+        if ( size )
+        {
+            m_sink = buffer[size - 1];
+        }
+    }
+
+    void sendRepeat(uint8_t data, uint32_t count)
+    {
+        m_sink = data;
+    }
+
+    void sendRepeat16(uint16_t data, uint32_t count)
+    {
+        m_sink = data;
+    }
+
+private:
+    volatile uint8_t m_sink = 0;
+};
+
+typedef CountingBus<NullBus> BenchBus;
+
+/** D/C pin of SPI displays. Writes to the pin go to the bus statistics, not to gpio */
+static const int8_t BENCH_DC_PIN = 0;
+
+static void onDcWrite(void *arg, int level)
+{
+    reinterpret_cast<BenchBus *>(arg)->setDataMode(level == LCD_HIGH);
+}
+
+struct BenchResult
+{
+    std::string name;
+    double nsPerPixel;
+    uint32_t callsPerFrame;
+    uint32_t bytesPerFrame;
+    uint32_t commandBytesPerFrame;
+    uint32_t dataBytesPerFrame;
+};
+
+static const char *s_filter = nullptr;
+static std::vector<BenchResult> s_results;
+
+static const char s_text[] = "Benchmark 0123456789";
+
+static uint8_t s_bitmap[32 * 32 / 8];
+
+/**
+ * Runs func until CONFIG_BENCHMARK_CASE_MS elapsed, and stores ns per pixel.
+ * If bus is not null, bus calls and bytes of single run are stored too.
+ */
+template <typename F> static void runCase(const std::string &name, uint32_t pixels, BenchBus *bus, F func)
+{
+    if ( s_filter && name.find(s_filter) == std::string::npos )
+    {
+        return;
+    }
+    typedef std::chrono::steady_clock Clock;
+    if ( bus )
+    {
+        bus->resetStats();
+    }
+    func(); // warm up, and collect bus statistics for single frame
+    BenchResult result;
+    result.name = name;
+    result.callsPerFrame = bus ? bus->getStats().calls : 0;
+    result.bytesPerFrame = bus ? bus->getStats().bytes : 0;
+    result.commandBytesPerFrame = bus ? bus->getStats().commandBytes : 0;
+    result.dataBytesPerFrame = bus ? bus->getStats().dataBytes : 0;
+    uint32_t iterations = 0;
+    auto start = Clock::now();
+    auto end = start;
+    do
+    {
+        for ( int i = 0; i < 16; i++ )
+        {
+            func();
+        }
+        iterations += 16;
+        end = Clock::now();
+    } while ( std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() < CONFIG_BENCHMARK_CASE_MS );
+    double ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+    result.nsPerPixel = ns / iterations / pixels;
+    s_results.push_back(result);
+    printf("%-28s %10.3f ns/px %8u calls %8u bytes %8u cmd %8u data\n", name.c_str(), result.nsPerPixel,
+           result.callsPerFrame, result.bytesPerFrame, result.commandBytesPerFrame, result.dataBytesPerFrame);
+}
+
+template <uint8_t BPP> static void benchCanvas()
+{
+    static NanoCanvas<128, 64, BPP> canvas;
+    static NanoCanvas<64, 128, BPP> rotated;
+    std::string prefix = "canvas" + std::to_string(BPP) + ".";
+    canvas.setFixedFont(ssd1306xled_font6x8);
+    canvas.setColor(0xFFFF);
+    runCase(prefix + "clear", 128 * 64, nullptr, [&]() { canvas.clear(); });
+    runCase(prefix + "fillRect", 120 * 56, nullptr, [&]() { canvas.fillRect(4, 4, 123, 59); });
+    runCase(prefix + "drawLine", 128, nullptr, [&]() { canvas.drawLine(0, 0, 127, 63); });
+    runCase(prefix + "drawBitmap1", 32 * 32, nullptr, [&]() { canvas.drawBitmap1(5, 3, 32, 32, s_bitmap); });
+    runCase(prefix + "printFixed", (sizeof(s_text) - 1) * 6 * 8, nullptr,
+            [&]() { canvas.printFixed(0, 8, s_text); });
+    if ( BPP == 1 ) // rotateCW() is implemented for monochrome canvas only
+    {
+        runCase(prefix + "rotateCW", 128 * 64, nullptr, [&]() { canvas.rotateCW(rotated); });
+    }
+}
+
+template <uint8_t BPP, class D> static void benchDisplay(D &display)
+{
+    static NanoCanvas<64, 32, BPP> canvas;
+    BenchBus &bus = display.getInterface();
+    std::string prefix = "display" + std::to_string(BPP) + ".";
+    lcd_registerGpioWriteHandler(BENCH_DC_PIN, onDcWrite, &bus);
+    display.begin();
+    uint32_t area = display.width() * display.height();
+    display.setFixedFont(ssd1306xled_font6x8);
+    display.setColor(0xFFFF);
+    canvas.setColor(0xFFFF);
+    canvas.fillRect(0, 0, 31, 15);
+    runCase(prefix + "clear", area, &bus, [&]() { display.clear(); });
+    runCase(prefix + "fillRect", area, &bus,
+            [&]() { display.fillRect(0, 0, display.width() - 1, display.height() - 1); });
+    runCase(prefix + "drawLine", display.width(), &bus,
+            [&]() { display.drawLine(0, 0, display.width() - 1, display.height() - 1); });
+    runCase(prefix + "drawBitmap1", 32 * 32, &bus, [&]() { display.drawBitmap1(8, 8, 32, 32, s_bitmap); });
+    runCase(prefix + "printFixed", (sizeof(s_text) - 1) * 6 * 8, &bus,
+            [&]() { display.printFixed(0, 8, s_text); });
+    runCase(prefix + "drawCanvas", 64 * 32, &bus, [&]() { display.drawCanvas(8, 8, canvas); });
+    display.end();
+    lcd_unregisterGpioWriteHandler(BENCH_DC_PIN);
+}
+
+static bool saveBaseline(const char *name)
+{
+    FILE *f = fopen(name, "w");
+    if ( !f )
+    {
+        fprintf(stderr, "Failed to open %s\n", name);
+        return false;
+    }
+    for ( auto &r : s_results )
+    {
+        fprintf(f, "%s %.4f\n", r.name.c_str(), r.nsPerPixel);
+    }
+    fclose(f);
+    return true;
+}
+
+static int compareBaseline(const char *name, double threshold)
+{
+    FILE *f = fopen(name, "r");
+    if ( !f )
+    {
+        fprintf(stderr, "Failed to open %s\n", name);
+        return -1;
+    }
+    std::map<std::string, double> baseline;
+    char caseName[64];
+    double value;
+    while ( fscanf(f, "%63s %lf", caseName, &value) == 2 )
+    {
+        baseline[caseName] = value;
+    }
+    fclose(f);
+    int regressions = 0;
+    printf("\n%-28s %10s %10s %8s\n", "case", "ns/px", "baseline", "delta");
+    for ( auto &r : s_results )
+    {
+        auto it = baseline.find(r.name);
+        if ( it == baseline.end() || it->second <= 0 )
+        {
+            printf("%-28s %10.3f %10s\n", r.name.c_str(), r.nsPerPixel, "-");
+            continue;
+        }
+        double delta = (r.nsPerPixel - it->second) * 100.0 / it->second;
+        bool regression = delta > threshold;
+        regressions += regression;
+        printf("%-28s %10.3f %10.3f %+7.1f%%%s\n", r.name.c_str(), r.nsPerPixel, it->second, delta,
+               regression ? "  REGRESSION" : "");
+    }
+    return regressions;
+}
+
+int main(int argc, char *argv[])
+{
+    const char *saveName = nullptr;
+    const char *compareName = nullptr;
+    double threshold = 10.0;
+    for ( int i = 1; i < argc; i++ )
+    {
+        if ( !strcmp(argv[i], "-f") && i + 1 < argc )
+        {
+            s_filter = argv[++i];
+        }
+        else if ( !strcmp(argv[i], "-s") && i + 1 < argc )
+        {
+            saveName = argv[++i];
+        }
+        else if ( !strcmp(argv[i], "-c") && i + 1 < argc )
+        {
+            compareName = argv[++i];
+        }
+        else if ( !strcmp(argv[i], "-t") && i + 1 < argc )
+        {
+            threshold = atof(argv[++i]);
+        }
+        else
+        {
+            fprintf(stderr, "Usage: %s [-f filter] [-s baseline] [-c baseline] [-t percent]\n", argv[0]);
+            return 2;
+        }
+    }
+    for ( unsigned i = 0; i < sizeof(s_bitmap); i++ )
+    {
+        s_bitmap[i] = (uint8_t)(i * 37 + 0x5A);
+    }
+
+    benchCanvas<1>();
+    benchCanvas<4>();
+    benchCanvas<8>();
+    benchCanvas<16>();
+
+    DisplaySSD1306_128x64_CustomI2C<BenchBus> display1(-1, -1);
+    benchDisplay<1>(display1);
+    DisplaySSD1325_128x64_CustomI2C<BenchBus> display4(-1, -1);
+    benchDisplay<4>(display4);
+    DisplaySSD1331_96x64x8_CustomSPI<BenchBus> display8(-1, BENCH_DC_PIN, COUNTING_BUS_DC_MANUAL);
+    benchDisplay<8>(display8);
+    DisplayILI9341_240x320x16_CustomSPI<BenchBus> display16(-1, BENCH_DC_PIN, COUNTING_BUS_DC_MANUAL);
+    benchDisplay<16>(display16);
+
+    if ( saveName && !saveBaseline(saveName) )
+    {
+        return 2;
+    }
+    if ( compareName )
+    {
+        int regressions = compareBaseline(compareName, threshold);
+        if ( regressions < 0 )
+        {
+            return 2;
+        }
+        return regressions ? 1 : 0;
+    }
+    return 0;
+}
@@ -34,7 +34,9 @@
 #include "sdl_ili9341.h"
 #include "sdl_pcd8544.h"
 #include <unistd.h>
+#if !defined(SDL_HEADLESS)
 #include <SDL2/SDL.h>
+#endif
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
@@ -120,6 +122,7 @@ void sdl_core_init(void)
 
 static void sdl_poll_event(void)
 {
+#if !defined(SDL_HEADLESS)
     SDL_Event event;
     while (SDL_PollEvent(&event))
     {
@@ -152,6 +155,7 @@ static void sdl_poll_event(void)
                 break;
         };
     }
+#endif
 }
 
 void sdl_set_dc_pin(int pin)
@@ -187,10 +191,24 @@ int sdl_read_digital(int pin)
     return s_digitalPins[pin];
 }
 
+void sdl_core_draw(void)
+{
+    sdl_poll_event();
+    sdl_graphics_flush();
+    sdl_core_capture_frame();
+}
+
+void sdl_core_set_refresh_rate(int rate)
+{
+    sdl_graphics_set_refresh_rate(rate);
+}
+
 void sdl_core_close(void)
 {
     sdl_graphics_close();
+#if !defined(SDL_HEADLESS)
     SDL_Quit();
+#endif
     unregister_oleds();
 }
 
@@ -76,14 +76,47 @@ extern int sdl_read_digital(int pin);
 /** returns 1 if dc pin is set to high, otherwise 0 */
 extern int sdl_is_dc_mode();
 
+/** Refresh rate value, which makes emulator to synchronize screen updates with vsync */
+#define SDL_REFRESH_RATE_VSYNC  (-1)
+
 extern void sdl_core_init(void);
+/** Processes SDL events and presents the last changes, which were delayed by refresh rate limit */
 extern void sdl_core_draw(void);
+/**
+ * Sets maximum number of screen presents per second (60 by default).
+ * 0 presents every update, SDL_REFRESH_RATE_VSYNC waits for vsync (must be set
+ * before sdl_core_init()). SDL_EMULATOR_REFRESH_RATE environment variable can
+ * be used to set the rate too.
+ */
+extern void sdl_core_set_refresh_rate(int rate);
 extern void sdl_core_close(void);
 /** Allocates buffer, returns number of bytes allocated */
 extern void sdl_core_get_pixels_data( uint8_t *pixels, uint8_t target_bpp );
 /** Returns length in bytes, required to hold the data */
 extern int sdl_core_get_pixels_len( uint8_t target_bpp );
 extern void sdl_core_set_unittest_mode(void);
+/**
+ * Returns pointer to emulated GDRAM in emulator native pixel format
+ * (8, 16 or 32 bits per pixel), and fills width, height and bpp of the framebuffer.
+ */
+extern const void *sdl_core_get_framebuffer(int *width, int *height, int *bpp);
+/** Reads pixel of emulated display as 3 bytes: red, green and blue */
+extern void sdl_core_get_pixel_rgb(int x, int y, uint8_t *rgb);
+/** Saves emulated display content to binary PPM file. Returns 0 on success */
+extern int sdl_core_save_ppm(const char *filename);
+/**
+ * Starts writing captured frames to the file as raw RGB888 data
+ * (width * height * 3 bytes per frame). NULL stops writing.
+ * Returns 0 on success
+ */
+extern int sdl_core_set_frame_stream(const char *filename);
+/**
+ * Ends emulated frame: if display content changed since previous call, counts the frame
+ * and writes it to the frame stream. sdl_core_draw() (lcd_delay()) calls it too.
+ */
+extern void sdl_core_capture_frame(void);
+/** Returns number of captured frames, which changed emulated display content */
+extern uint32_t sdl_core_get_frame_count(void);
 
 #ifdef __cplusplus
 }
@@ -40,7 +40,7 @@
  * it wraps to pageStart and column increments. When false, column
  * increments first with analogous wrapping.
  *
- * Used by SSD1306, SSD1331, SSD1351, IL9163, ILI9341.
+ * Used by SSD1306, SSD1331, SSD1351, IL9163, ILI9341, PCD8544.
  */
 static inline void sdl_emu_advance_xy(
     int *col, int *page,
@@ -78,7 +78,7 @@ static inline void sdl_emu_advance_xy(
 /**
  * Advance a single axis (column or page) with wrapping.
  *
- * Used by emulators with simpler addressing modes like PCD8544 and SH1107
+ * Used by emulators with simpler addressing modes like SH1107
  * where only one axis increments at a time.
  */
 static inline void sdl_emu_advance_single(int *pos, int start, int end)
@@ -23,9 +23,12 @@
 */
 
 #include "sdl_graphics.h"
+#include "sdl_core.h"
 #include "sdl_oled_basic.h"
 #include <unistd.h>
+#if !defined(SDL_HEADLESS)
 #include <SDL2/SDL.h>
+#endif
 #include <stdlib.h>
 #include <stdio.h>
 #include <stdbool.h>
@@ -33,9 +36,12 @@
 
 #define CANVAS_REFRESH_RATE  60
 
+#if !defined(SDL_HEADLESS)
+static uint32_t       s_last_present = 0;
 static SDL_Window     *g_window = NULL;
 static SDL_Renderer   *g_renderer = NULL;
 static SDL_Texture    *g_texture = NULL;
+#endif
 void                  *g_pixels = NULL;
 
 static int s_width = 128;
@@ -43,6 +49,51 @@ static int s_height = 64;
 static int s_bpp = 16;
 static uint32_t s_pixfmt = SDL_PIXELFORMAT_RGB565;
 static bool s_unittest_mode = false;
+static int s_refresh_rate = CANVAS_REFRESH_RATE;
+static bool s_present_pending = false;
+static uint32_t s_frame_count = 0;
+static FILE *s_frame_stream = NULL;
+/* Display content changed since last sdl_core_capture_frame() */
+static bool s_frame_changed = false;
+
+/* Damaged area of g_pixels, which is not uploaded to the texture yet. Empty if x1 > x2 */
+static int s_damage_x1 = 0;
+static int s_damage_y1 = 0;
+static int s_damage_x2 = -1;
+static int s_damage_y2 = -1;
+
+
+static void sdl_damage_reset(void)
+{
+    s_damage_x1 = 0;
+    s_damage_y1 = 0;
+    s_damage_x2 = -1;
+    s_damage_y2 = -1;
+}
+
+static inline void sdl_damage_pixel(int x, int y)
+{
+    if ( s_damage_x1 > s_damage_x2 )
+    {
+        s_damage_x1 = s_damage_x2 = x;
+        s_damage_y1 = s_damage_y2 = y;
+        return;
+    }
+    if ( x < s_damage_x1 ) s_damage_x1 = x;
+    if ( x > s_damage_x2 ) s_damage_x2 = x;
+    if ( y < s_damage_y1 ) s_damage_y1 = y;
+    if ( y > s_damage_y2 ) s_damage_y2 = y;
+}
+
+static void sdl_damage_all(void)
+{
+    s_damage_x1 = 0;
+    s_damage_y1 = 0;
+    s_damage_x2 = s_width - 1;
+    s_damage_y2 = s_height - 1;
+}
+
+#if !defined(SDL_HEADLESS)
 
 static int windowWidth() { return s_width * PIXEL_SIZE + BORDER_SIZE * 2; };
 static int windowHeight() { return s_height * PIXEL_SIZE + BORDER_SIZE * 2 + TOP_HEADER; };
@@ -59,6 +110,11 @@ void sdl_graphics_init(void)
         SDL_Init(0);
         return;
     }
+    const char *rate = getenv("SDL_EMULATOR_REFRESH_RATE");
+    if ( rate )
+    {
+        s_refresh_rate = atoi(rate);
+    }
     SDL_Init(SDL_INIT_EVERYTHING);
     g_window = SDL_CreateWindow
     (
@@ -68,9 +124,10 @@ void sdl_graphics_init(void)
         windowHeight(),
         SDL_WINDOW_SHOWN
     );
-    g_renderer =  SDL_CreateRenderer( g_window, -1, SDL_RENDERER_ACCELERATED );
+    uint32_t vsync = s_refresh_rate == SDL_REFRESH_RATE_VSYNC ? SDL_RENDERER_PRESENTVSYNC : 0;
+    g_renderer =  SDL_CreateRenderer( g_window, -1, SDL_RENDERER_ACCELERATED | vsync );
     if ( !g_renderer )
-        g_renderer =  SDL_CreateRenderer( g_window, -1, SDL_RENDERER_SOFTWARE );
+        g_renderer =  SDL_CreateRenderer( g_window, -1, SDL_RENDERER_SOFTWARE | vsync );
     // Set render color to black ( background will be rendered in this color )
     SDL_SetRenderDrawColor( g_renderer, 20, 20, 20, 255 );
 
@@ -139,30 +196,30 @@ static void sdl_draw_oled_frame(void)
 #endif
 }
 
-void sdl_graphics_refresh(void)
+static void sdl_upload_damage(void)
 {
-    if ( s_unittest_mode )
+    if ( s_damage_x1 > s_damage_x2 )
     {
         return;
     }
-    sdl_draw_oled_frame();
-    if (g_texture)
+    if ( g_texture )
     {
         SDL_Rect r;
         void * l_pixels;
         int  pitch;
-        if (SDL_LockTexture(g_texture, NULL, &l_pixels, &pitch) == 0)
+        int bytes = s_bpp / 8;
+        r.x = s_damage_x1;
+        r.y = s_damage_y1;
+        r.w = s_damage_x2 - s_damage_x1 + 1;
+        r.h = s_damage_y2 - s_damage_y1 + 1;
+        if (SDL_LockTexture(g_texture, &r, &l_pixels, &pitch) == 0)
         {
-            if (pitch != s_width * (s_bpp/8))
-            {
-                //fprintf(stderr, "Warning, pitch %d is not expected\n", pitch);
-            }
-            uint8_t *src = (uint8_t *)g_pixels;
-            for(int y=0; y<s_height;y++)
+            uint8_t *src = (uint8_t *)g_pixels + (r.y * s_width + r.x) * bytes;
+            for(int y=0; y<r.h;y++)
             {
-                 memcpy(l_pixels, src, s_width * (s_bpp/8));
+                 memcpy(l_pixels, src, r.w * bytes);
                  l_pixels = (void*)((uint8_t *)l_pixels + pitch);
-                 src += s_width * (s_bpp/8);
+                 src += s_width * bytes;
             }
             SDL_UnlockTexture(g_texture);
         }
@@ -171,6 +228,17 @@ void sdl_graphics_refresh(void)
             fprintf(stderr, "Something bad happened to SDL texture\n");
             exit(1);
         }
+        s_present_pending = true;
+    }
+    sdl_damage_reset();
+}
+
+static void sdl_present(void)
+{
+    sdl_draw_oled_frame();
+    if (g_texture)
+    {
+        SDL_Rect r;
         r.x = BORDER_SIZE;
         r.y = BORDER_SIZE + TOP_HEADER;
         r.w = windowWidth() - BORDER_SIZE * 2;
@@ -178,20 +246,84 @@ void sdl_graphics_refresh(void)
         SDL_RenderCopy(g_renderer, g_texture, NULL, &r);
     }
     SDL_RenderPresent(g_renderer);
+    s_last_present = SDL_GetTicks();
+    s_present_pending = false;
+}
+
+#else
+
+void sdl_graphics_init(void)
+{
+    s_unittest_mode = true;
+}
+
+static void sdl_upload_damage(void)
+{
+}
+
+static void sdl_present(void)
+{
+}
+
+#endif
+
+void sdl_graphics_refresh(void)
+{
+    if ( s_damage_x1 <= s_damage_x2 )
+    {
+        s_frame_changed = true;
+    }
+    if ( s_unittest_mode )
+    {
+        sdl_damage_reset();
+        return;
+    }
+    sdl_upload_damage();
+    if ( !s_present_pending )
+    {
+        return;
+    }
+#if !defined(SDL_HEADLESS)
+    /* Vsync mode is throttled by SDL_RenderPresent() itself */
+    if ( s_refresh_rate > 0 && (uint32_t)(SDL_GetTicks() - s_last_present) < 1000u / s_refresh_rate )
+    {
+        return;
+    }
+#endif
+    sdl_present();
+}
+
+void sdl_graphics_flush(void)
+{
+    if ( s_unittest_mode )
+    {
+        return;
+    }
+    sdl_upload_damage();
+    if ( s_present_pending )
+    {
+        sdl_present();
+    }
+}
+
+void sdl_graphics_set_refresh_rate(int rate)
+{
+    s_refresh_rate = rate;
 }
 
 void sdl_graphics_set_oled_params(int width, int height, int bpp, uint32_t pixfmt)
 {
-    SDL_Rect r;
     s_bpp = bpp;
     s_pixfmt = pixfmt;
     s_width = width;
     s_height = height;
+#if !defined(SDL_HEADLESS)
     if (g_texture)
     {
         SDL_DestroyTexture( g_texture );
         g_texture = NULL;
     }
+#endif
     free(g_pixels);
     g_pixels = NULL;
     g_pixels = malloc(s_width * s_height * (s_bpp / 8));
@@ -199,10 +331,13 @@ void sdl_graphics_set_oled_params(int width, int height, int bpp, uint32_t pixfm
     {
         memset(g_pixels, 0, s_width * s_height * (s_bpp / 8));
     }
+    sdl_damage_all();
     if ( s_unittest_mode )
     {
         return;
     }
+#if !defined(SDL_HEADLESS)
+    SDL_Rect r;
     g_texture = SDL_CreateTexture( g_renderer, s_pixfmt,
                                    SDL_TEXTUREACCESS_STREAMING,
                                    width, height );
@@ -220,6 +355,7 @@ void sdl_graphics_set_oled_params(int width, int height, int bpp, uint32_t pixfm
     r.h = windowHeight() - RECT_THICKNESS*2;
     SDL_RenderFillRect( g_renderer, &r );
     sdl_draw_oled_frame();
+#endif
 }
 
 void sdl_put_pixel(int x, int y, uint32_t color)
@@ -231,6 +367,7 @@ void sdl_put_pixel(int x, int y, uint32_t color)
     if (g_pixels)
     {
         int index = x + y * s_width;
+        sdl_damage_pixel(x, y);
         switch (s_bpp)
         {
             case 8:
@@ -278,10 +415,12 @@ uint32_t sdl_get_pixel(int x, int y)
 
 void sdl_graphics_close(void)
 {
+    sdl_core_set_frame_stream(NULL);
     if ( s_unittest_mode )
     {
         return;
     }
+#if !defined(SDL_HEADLESS)
     if (g_texture)
     {
         SDL_DestroyTexture(g_texture);
@@ -297,6 +436,7 @@ void sdl_graphics_close(void)
         SDL_DestroyWindow(g_window);
         g_window = NULL;
     }
+#endif
     free(g_pixels);
     g_pixels = NULL;
 }
@@ -352,3 +492,131 @@ void sdl_core_set_unittest_mode(void)
 {
     s_unittest_mode = true;
 }
+
+const void *sdl_core_get_framebuffer(int *width, int *height, int *bpp)
+{
+    if ( width ) *width = s_width;
+    if ( height ) *height = s_height;
+    if ( bpp ) *bpp = s_bpp;
+    return g_pixels;
+}
+
+void sdl_core_get_pixel_rgb(int x, int y, uint8_t *rgb)
+{
+    uint32_t pixel = convert_pixel( sdl_get_pixel( x, y ), 32 );
+    rgb[0] = pixel >> 24;
+    rgb[1] = pixel >> 16;
+    rgb[2] = pixel >> 8;
+}
+
+/* Converts whole framebuffer to RGB888. Returns NULL if there is no framebuffer or memory */
+static uint8_t *sdl_get_frame_rgb(void)
+{
+    int count = s_width * s_height;
+    uint8_t *rgb = g_pixels ? malloc(count * 3) : NULL;
+    if ( !rgb )
+    {
+        return NULL;
+    }
+    uint8_t *dst = rgb;
+    switch ( s_pixfmt )
+    {
+        case SDL_PIXELFORMAT_RGB332:
+            for (const uint8_t *src = g_pixels; count--; src++, dst += 3)
+            {
+                dst[0] = *src & 0xE0;
+                dst[1] = (*src & 0x1C) << 3;
+                dst[2] = (*src & 0x03) << 6;
+            }
+            break;
+        case SDL_PIXELFORMAT_RGB565:
+            for (const uint16_t *src = g_pixels; count--; src++, dst += 3)
+            {
+                dst[0] = (*src & 0xF800) >> 8;
+                dst[1] = (*src & 0x07E0) >> 3;
+                dst[2] = (*src & 0x001F) << 3;
+            }
+            break;
+        case SDL_PIXELFORMAT_RGBX8888:
+            for (const uint32_t *src = g_pixels; count--; src++, dst += 3)
+            {
+                dst[0] = *src >> 24;
+                dst[1] = *src >> 16;
+                dst[2] = *src >> 8;
+            }
+            break;
+        default:
+            memset(rgb, 0, count * 3);
+            break;
+    }
+    return rgb;
+}
+
+int sdl_core_save_ppm(const char *filename)
+{
+    uint8_t *rgb = sdl_get_frame_rgb();
+    if ( !rgb )
+    {
+        return -1;
+    }
+    FILE *f = fopen(filename, "wb");
+    if ( !f )
+    {
+        fprintf(stderr, "Failed to open %s\n", filename);
+        free(rgb);
+        return -1;
+    }
+    fprintf(f, "P6\n%d %d\n255\n", s_width, s_height);
+    fwrite(rgb, 3, s_width * s_height, f);
+    fclose(f);
+    free(rgb);
+    return 0;
+}
+
+void sdl_core_capture_frame(void)
+{
+    if ( s_damage_x1 <= s_damage_x2 )
+    {
+        s_frame_changed = true;
+    }
+    if ( !s_frame_changed )
+    {
+        return;
+    }
+    s_frame_changed = false;
+    s_frame_count++;
+    if ( s_frame_stream )
+    {
+        uint8_t *rgb = sdl_get_frame_rgb();
+        if ( rgb )
+        {
+            fwrite(rgb, 3, s_width * s_height, s_frame_stream);
+            fflush(s_frame_stream);
+            free(rgb);
+        }
+    }
+}
+
+int sdl_core_set_frame_stream(const char *filename)
+{
+    if ( s_frame_stream )
+    {
+        fclose(s_frame_stream);
+        s_frame_stream = NULL;
+    }
+    if ( filename )
+    {
+        s_frame_stream = fopen(filename, "wb");
+        if ( !s_frame_stream )
+        {
+            fprintf(stderr, "Failed to open %s\n", filename);
+            return -1;
+        }
+    }
+    return 0;
+}
+
+uint32_t sdl_core_get_frame_count(void)
+{
+    return s_frame_count;
+}
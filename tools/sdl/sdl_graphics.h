@@ -32,7 +32,12 @@ extern "C" {
 #endif
 
 extern void sdl_graphics_init(void);
+/** Uploads changed area to the screen, presents it not more often than refresh rate allows */
 extern void sdl_graphics_refresh(void);
+/** Presents all pending changes immediately */
+extern void sdl_graphics_flush(void);
+/** Sets maximum number of presents per second, see sdl_core_set_refresh_rate() */
+extern void sdl_graphics_set_refresh_rate(int rate);
 extern void sdl_graphics_close(void);
 
 extern void sdl_graphics_set_oled_params(int width, int height, int bpp, uint32_t pixfmt);
@@ -36,9 +36,59 @@ static int s_pageStart = 0;
 static int s_pageEnd = 7;
 static uint8_t detected = 0;
 
+/* Vertical scrolling area and start address in frame memory lines (VSCRDEF, VSCRSADD) */
+static int s_scrollTop = 0;
+static int s_scrollSize = 320;
+static int s_scrollStart = 0;
+static int s_scrollArgs[6];
+
+/*
+ * In default orientation the library sets MY bit, so frame memory line 0 is
+ * at the bottom of the emulated screen.
+ */
+static int ili9341_screen_row(int line)
+{
+    if ( line >= s_scrollTop && line < s_scrollTop + s_scrollSize )
+    {
+        line = s_scrollTop + ((line - s_scrollStart) % s_scrollSize + s_scrollSize) % s_scrollSize;
+    }
+    return sdl_ili9341.height - 1 - line;
+}
+
+static void ili9341_set_scroll(int top, int size, int start)
+{
+    static uint32_t memory[320][240];
+    if ( size <= 0 || top < 0 || top + size > sdl_ili9341.height || start < top || start >= top + size )
+    {
+        return;
+    }
+    for ( int line = 0; line < sdl_ili9341.height; line++ )
+    {
+        int row = ili9341_screen_row(line);
+        for ( int x = 0; x < sdl_ili9341.width; x++ )
+        {
+            memory[line][x] = sdl_get_pixel(x, row);
+        }
+    }
+    s_scrollTop = top;
+    s_scrollSize = size;
+    s_scrollStart = start;
+    for ( int line = 0; line < sdl_ili9341.height; line++ )
+    {
+        int row = ili9341_screen_row(line);
+        for ( int x = 0; x < sdl_ili9341.width; x++ )
+        {
+            sdl_put_pixel(x, row, memory[line][x]);
+        }
+    }
+}
+
 static void sdl_ili9341_reset(void)
 {
     detected = 0;
+    s_scrollTop = 0;
+    s_scrollSize = sdl_ili9341.height;
+    s_scrollStart = 0;
 }
 
 static int sdl_ili9341_detect(uint8_t data)
@@ -166,6 +216,23 @@ static void sdl_ili9341_commands(uint8_t data)
                 default: break;
             }
             break;
+        case 0x33: // Vertical Scrolling Definition (6 args)
+            s_scrollArgs[s_cmdArgIndex] = data;
+            if ( s_cmdArgIndex == 5 )
+            {
+                ili9341_set_scroll( (s_scrollArgs[0] << 8) | s_scrollArgs[1],
+                                    (s_scrollArgs[2] << 8) | s_scrollArgs[3], s_scrollStart );
+                s_commandId = SSD_COMMAND_NONE;
+            }
+            break;
+        case 0x37: // Vertical Scrolling Start Address (2 args)
+            s_scrollArgs[s_cmdArgIndex] = data;
+            if ( s_cmdArgIndex == 1 )
+            {
+                ili9341_set_scroll( s_scrollTop, s_scrollSize, (s_scrollArgs[0] << 8) | s_scrollArgs[1] );
+                s_commandId = SSD_COMMAND_NONE;
+            }
+            break;
         case 0x2C:
             sdl_set_data_mode( SDM_WRITE_DATA );
             s_commandId = SSD_COMMAND_NONE;
@@ -261,7 +328,7 @@ void sdl_ili9341_data(uint8_t data)
     }
     if ( rx >= 0 && ry >= 0 && rx < sdl_ili9341.width && ry < sdl_ili9341.height )
     {
-        sdl_put_pixel(rx, ry, (dataFirst<<8) | data);
+        sdl_put_pixel(rx, ili9341_screen_row(sdl_ili9341.height - 1 - ry), (dataFirst<<8) | data);
     }
 
     sdl_emu_advance_xy(&s_activeColumn, &s_activePage,
@@ -26,7 +26,14 @@
 #define _SDL_OLED_BASIC_H_
 
 #include <stdint.h>
+#if defined(SDL_HEADLESS)
+/* Headless build doesn't depend on SDL, these values match SDL_PixelFormatEnum */
+#define SDL_PIXELFORMAT_RGB332    0x14110801u
+#define SDL_PIXELFORMAT_RGB565    0x15151002u
+#define SDL_PIXELFORMAT_RGBX8888  0x16261804u
+#else
 #include <SDL2/SDL.h>
+#endif
 
 #ifdef __cplusplus
 extern "C" {
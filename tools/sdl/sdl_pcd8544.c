@@ -97,10 +97,10 @@ void sdl_pcd8544_data(uint8_t data)
             sdl_put_pixel(x, (y<<3) + i, 0x0000);
         }
     }
-    if (s_verticalMode)
-        sdl_emu_advance_single(&s_activePage, s_pageStart, s_pageEnd);
-    else
-        sdl_emu_advance_single(&s_activeColumn, s_columnStart, s_columnEnd);
+    /* Both addressing modes wrap to the next bank/column as real controller does */
+    sdl_emu_advance_xy(&s_activeColumn, &s_activePage,
+                       s_columnStart, s_columnEnd, s_pageStart, s_pageEnd,
+                       s_verticalMode);
 }
 
 sdl_oled_info sdl_pcd8544 =
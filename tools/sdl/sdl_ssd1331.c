@@ -47,6 +47,35 @@ static uint8_t s_16bitmode = 0;
 static uint8_t detected_x8 = 0;
 static uint8_t detected_x16 = 0;
 
+static uint8_t s_fillEnable = 0;
+static uint32_t s_fillColor = 0;
+
+/* Accelerator commands address GDRAM, which is mapped to the screen the same way as data */
+static void gdram_put_pixel(int col, int row, uint32_t color)
+{
+    int x = s_leftToRight ? col : (sdl_ssd1331x8.width - col - 1);
+    int y = s_topToBottom ? row : (sdl_ssd1331x8.height - row - 1);
+    sdl_put_pixel(x, y, color);
+}
+
+static uint32_t gdram_get_pixel(int col, int row)
+{
+    int x = s_leftToRight ? col : (sdl_ssd1331x8.width - col - 1);
+    int y = s_topToBottom ? row : (sdl_ssd1331x8.height - row - 1);
+    return sdl_get_pixel(x, y);
+}
+
+/* Color of accelerator commands: 3 bytes of 6-bit channels, high bits of pixel value first */
+static void addColorByte(uint32_t *color, int index, uint8_t data)
+{
+    switch (index)
+    {
+        case 0: *color |= s_16bitmode ? ((data & 0x3E) << 10) : ((data & 0x38) << 2); break;
+        case 1: *color |= s_16bitmode ? ((data & 0x3F) << 5) : ((data & 0x38) >> 1); break;
+        default: *color |= s_16bitmode ? ((data & 0x3E) >> 1) : ((data & 0x30) >> 4); break;
+    }
+}
+
 static void copyBlock()
 {
     int x_start = s_newColumn;
@@ -65,38 +94,76 @@ static void copyBlock()
                  ((x_dir > 0) && (x <= x_end)) || ((x_dir < 0) && (x >= x_start));
                  x = x + x_dir)
         {
-            sdl_put_pixel(x, y, sdl_get_pixel( x + s_columnStart - s_newColumn,
-                                               y + s_pageStart - s_newPage ));
+            gdram_put_pixel(x, y, gdram_get_pixel( x + s_columnStart - s_newColumn,
+                                                   y + s_pageStart - s_newPage ));
         }
     }
 }
 
+/* Bresenham line, both end points are included */
 static void drawLine()
 {
-    if ( abs(s_columnStart - s_columnEnd) > abs(s_pageStart - s_pageEnd) )
+    int x1 = s_columnStart, y1 = s_pageStart;
+    int x2 = s_columnEnd, y2 = s_pageEnd;
+    int dx = abs(x2 - x1);
+    int dy = abs(y2 - y1);
+    int err = 0;
+    if ( dy > dx )
     {
-        int x = s_columnStart;
-        while (x != s_columnEnd)
+        if ( y1 > y2 )
+        {
+            int t = x1; x1 = x2; x2 = t;
+            t = y1; y1 = y2; y2 = t;
+        }
+        for ( ; y1 <= y2; y1++ )
         {
-            int y = s_pageStart + (s_pageEnd - s_pageStart)*(x - s_columnStart)/(s_columnEnd - s_columnStart);
-            sdl_put_pixel(x, y, s_color);
-            x += (s_columnEnd > s_columnStart ? 1: -1);
+            gdram_put_pixel(x1, y1, s_color);
+            err += dx;
+            if ( err >= dy )
+            {
+                err -= dy;
+                x1 += x1 < x2 ? 1 : -1;
+            }
         }
     }
     else
     {
-        int y = s_pageStart;
-        while (y != s_pageEnd)
+        if ( x1 > x2 )
         {
-            int x = s_columnStart + (s_columnEnd - s_columnStart)*(y - s_pageStart)/(s_pageEnd - s_pageStart);
-            sdl_put_pixel(x, y, s_color);
-            y += (s_pageEnd > s_pageStart ? 1: -1);
+            int t = x1; x1 = x2; x2 = t;
+            t = y1; y1 = y2; y2 = t;
+        }
+        for ( ; x1 <= x2; x1++ )
+        {
+            gdram_put_pixel(x1, y1, s_color);
+            err += dy;
+            if ( err >= dx )
+            {
+                err -= dx;
+                y1 += y1 < y2 ? 1 : -1;
+            }
+        }
+    }
+}
+
+static void drawRect()
+{
+    for ( int y = s_pageStart; y <= s_pageEnd; y++ )
+    {
+        for ( int x = s_columnStart; x <= s_columnEnd; x++ )
+        {
+            int border = x == s_columnStart || x == s_columnEnd || y == s_pageStart || y == s_pageEnd;
+            if ( border )
+                gdram_put_pixel(x, y, s_color);
+            else if ( s_fillEnable )
+                gdram_put_pixel(x, y, s_fillColor);
         }
     }
 }
 
 static void sdl_ssd1331_reset(void)
 {
+    s_fillEnable = 0;
     detected_x8 = 0;
     detected_x16 = 0;
 }
@@ -157,22 +224,11 @@ static void sdl_ssd1331_commands(uint8_t data)
                 case 2: s_columnEnd = data; break;
                 case 3: s_pageEnd = data; break;
                 case 4:
-                    if (s_16bitmode)
-                        s_color |= ((data & 0x3F) >> 1);
-                    else
-                        s_color |= ((data & 0x30) >> 4);
-                    break;
                 case 5:
-                    if (s_16bitmode)
-                        s_color |= ((data & 0x3F) << 5);
-                    else
-                        s_color |= ((data & 0x30) >> 1);
+                    addColorByte(&s_color, s_cmdArgIndex - 4, data);
                     break;
                 case 6:
-                     if (s_16bitmode)
-                        s_color |= ((data & 0x3E) << 10);
-                     else
-                        s_color |= ((data & 0x38) << 2);
+                     addColorByte(&s_color, 2, data);
                      drawLine();
                      s_commandId = SSD_COMMAND_NONE;
                      break;
@@ -180,6 +236,57 @@ static void sdl_ssd1331_commands(uint8_t data)
                      break;
             }
             break;
+        case 0x22: // DRAW RECTANGLE
+            switch (s_cmdArgIndex)
+            {
+                case 0: s_columnStart = data; s_color = 0; s_fillColor = 0; break;
+                case 1: s_pageStart = data; break;
+                case 2: s_columnEnd = data; break;
+                case 3: s_pageEnd = data; break;
+                case 4:
+                case 5:
+                case 6:
+                    addColorByte(&s_color, s_cmdArgIndex - 4, data);
+                    break;
+                case 7:
+                case 8:
+                    addColorByte(&s_fillColor, s_cmdArgIndex - 7, data);
+                    break;
+                case 9:
+                     addColorByte(&s_fillColor, 2, data);
+                     drawRect();
+                     s_commandId = SSD_COMMAND_NONE;
+                     break;
+                default:
+                     break;
+            }
+            break;
+        case 0x25: // CLEAR WINDOW
+            switch (s_cmdArgIndex)
+            {
+                case 0: s_columnStart = data; break;
+                case 1: s_pageStart = data; break;
+                case 2: s_columnEnd = data; break;
+                case 3:
+                     s_pageEnd = data;
+                     s_color = 0;
+                     s_fillColor = 0;
+                     s_fillEnable = 1;
+                     drawRect();
+                     s_fillEnable = 0;
+                     s_commandId = SSD_COMMAND_NONE;
+                     break;
+                default:
+                     break;
+            }
+            break;
+        case 0x26: // FILL ENABLE
+            if ( s_cmdArgIndex == 0 )
+            {
+                s_fillEnable = data & 0x01;
+                s_commandId = SSD_COMMAND_NONE;
+            }
+            break;
         case 0x23: // MOVE BLOCK
             switch (s_cmdArgIndex)
             {
@@ -224,20 +331,12 @@ static void sdl_ssd1331_commands(uint8_t data)
         case 0xB6: // Second Pre-charge Period
         case 0xBB: // Pre-charge Level
         case 0xBE: // VCOMH Voltage
-        case 0x26: // Fill Enable/Disable
             if ( s_cmdArgIndex == 0 )
             {
                 s_commandId = SSD_COMMAND_NONE;
             }
             break;
-        case 0x22: // Draw Rectangle (10 args)
-            if ( s_cmdArgIndex == 9 )
-            {
-                s_commandId = SSD_COMMAND_NONE;
-            }
-            break;
         case 0x24: // Dim Window (4 args)
-        case 0x25: // Clear Window (4 args)
             if ( s_cmdArgIndex == 3 )
             {
                 s_commandId = SSD_COMMAND_NONE;
@@ -23,6 +23,7 @@
 */
 
 #include <CppUTest/TestHarness.h>
+#include <stdlib.h>
 #include <string.h>
 #include "canvas/canvas.h"
 #include "canvas/fonts/fonts.h"
@@ -257,6 +258,135 @@ TEST(Canvas8, drawLine_vertical)
         CHECK_EQUAL(0xFF, px(10, y));
 }
 
+TEST(Canvas8, fillCircle_matches_drawCircle_outline)
+{
+    for (int r = 1; r <= 15; r++)
+    {
+        int left[CH], right[CH];
+        canvas.clear();
+        canvas.drawCircle(16, 16, r);
+        for (int y = 0; y < CH; y++)
+        {
+            left[y] = CW;
+            right[y] = -1;
+            for (int x = 0; x < CW; x++)
+            {
+                if (px(x, y))
+                {
+                    left[y] = left[y] < x ? left[y] : x;
+                    right[y] = x;
+                }
+            }
+        }
+        canvas.clear();
+        canvas.fillCircle(16, 16, r);
+        for (int y = 0; y < CH; y++)
+        {
+            for (int x = 0; x < CW; x++)
+                CHECK_EQUAL(x >= left[y] && x <= right[y] ? 0xFF : 0x00, px(x, y));
+        }
+    }
+}
+
+TEST(Canvas8, fillRoundRect_cuts_corners)
+{
+    canvas.fillRoundRect(2, 4, 29, 20, 5);
+    CHECK_EQUAL(0x00, px(2, 4));
+    CHECK_EQUAL(0x00, px(29, 4));
+    CHECK_EQUAL(0x00, px(2, 20));
+    CHECK_EQUAL(0x00, px(29, 20));
+    CHECK_EQUAL(0xFF, px(7, 4));
+    CHECK_EQUAL(0xFF, px(24, 20));
+    CHECK_EQUAL(0xFF, px(2, 9));
+    CHECK_EQUAL(0xFF, px(29, 15));
+    CHECK_EQUAL(0xFF, px(16, 12));
+    CHECK_EQUAL(0x00, px(16, 3));
+    CHECK_EQUAL(0x00, px(16, 21));
+}
+
+TEST(Canvas8, fillTriangle_covers_vertices)
+{
+    canvas.fillTriangle(2, 2, 28, 10, 10, 28);
+    CHECK_EQUAL(0xFF, px(2, 2));
+    CHECK_EQUAL(0xFF, px(28, 10));
+    CHECK_EQUAL(0xFF, px(10, 28));
+    CHECK_EQUAL(0xFF, px(13, 13));
+    CHECK_EQUAL(0x00, px(28, 28));
+    CHECK_EQUAL(0x00, px(2, 28));
+    CHECK_EQUAL(0x00, px(28, 2));
+}
+
+TEST(Canvas8, fillPolygon_concave)
+{
+    // U shape: the notch between the arms must stay empty
+    NanoPoint points[] = {{2, 2}, {10, 2}, {10, 20}, {20, 20}, {20, 2}, {28, 2}, {28, 28}, {2, 28}};
+    canvas.fillPolygon(points, sizeof(points) / sizeof(points[0]));
+    CHECK_EQUAL(0xFF, px(2, 2));
+    CHECK_EQUAL(0xFF, px(5, 10));
+    CHECK_EQUAL(0xFF, px(25, 10));
+    CHECK_EQUAL(0xFF, px(15, 25));
+    CHECK_EQUAL(0xFF, px(28, 28));
+    CHECK_EQUAL(0x00, px(15, 10));
+    CHECK_EQUAL(0x00, px(15, 2));
+    CHECK_EQUAL(0x00, px(29, 15));
+    CHECK_EQUAL(0x00, px(1, 15));
+}
+
+TEST(Canvas8, drawThickLine_width)
+{
+    canvas.drawThickLine(4, 10, 27, 10, 3);
+    for (int x = 4; x <= 27; x++)
+    {
+        CHECK_EQUAL(0xFF, px(x, 9));
+        CHECK_EQUAL(0xFF, px(x, 10));
+        CHECK_EQUAL(0xFF, px(x, 11));
+        CHECK_EQUAL(0x00, px(x, 8));
+        CHECK_EQUAL(0x00, px(x, 12));
+    }
+    canvas.clear();
+    canvas.drawThickLine(4, 4, 27, 27, 5);
+    for (int i = 4; i <= 27; i++)
+        CHECK_EQUAL(0xFF, px(i, i));
+    CHECK_EQUAL(0xFF, px(16, 14));
+    CHECK_EQUAL(0xFF, px(14, 16));
+    CHECK_EQUAL(0x00, px(16, 10));
+    CHECK_EQUAL(0x00, px(10, 16));
+}
+
+static bool dirty_is(NanoCanvasOps<8> &canvas, int x1, int y1, int x2, int y2)
+{
+    const NanoRect &r = canvas.getDirtyRect();
+    return r.p1.x == x1 && r.p1.y == y1 && r.p2.x == x2 && r.p2.y == y2;
+}
+
+TEST(Canvas8, dirty_rect_tracks_drawing)
+{
+    CHECK_TRUE(dirty_is(canvas, 0, 0, CW - 1, CH - 1));
+    canvas.clear();
+    canvas.resetDirty();
+    CHECK_TRUE(canvas.getDirtyRect().p1.x > canvas.getDirtyRect().p2.x);
+    canvas.putPixel(5, 6);
+    CHECK_TRUE(dirty_is(canvas, 5, 6, 5, 6));
+    canvas.drawHLine(9, 3, 12);
+    canvas.drawLine(20, 20, 18, 25);
+    CHECK_TRUE(dirty_is(canvas, 5, 3, 20, 25));
+    canvas.resetDirty();
+    // Offset is applied, and the area is clipped by canvas borders
+    canvas.setOffset(10, 10);
+    canvas.fillRect(5, 30, 14, 50);
+    CHECK_TRUE(dirty_is(canvas, 0, 20, 4, CH - 1));
+    canvas.setOffset(0, 0);
+    canvas.resetDirty();
+    canvas.fillRect(40, 0, 50, 2);
+    CHECK_TRUE(canvas.getDirtyRect().p1.x > canvas.getDirtyRect().p2.x);
+    // clear() adds everything, drawn since previous clear()
+    canvas.clear();
+    CHECK_TRUE(dirty_is(canvas, 0, 3, 20, CH - 1));
+    canvas.resetDirty();
+    canvas.clear();
+    CHECK_TRUE(canvas.getDirtyRect().p1.x > canvas.getDirtyRect().p2.x);
+}
+
 // ============================================================
 // NanoCanvas16 tests (16-bit color)
 // ============================================================
@@ -333,6 +463,113 @@ TEST(Canvas16, color_value)
     CHECK_EQUAL(0x1234, px(0, 0));
 }
 
+TEST(Canvas16, fillRect_any_width_and_offset)
+{
+    canvas.setColor(0xA55A);
+    for ( int x = 0; x < 8; x++ )
+    {
+        for ( int w = 1; x + w <= CW; w++ )
+        {
+            memset(canvas16_buf, 0, sizeof(canvas16_buf));
+            canvas.fillRect(x, 3, x + w - 1, 4);
+            canvas.drawHLine(x, 6, x + w - 1);
+            for ( int i = 0; i < CW; i++ )
+            {
+                uint16_t expected = (i >= x && i < x + w) ? 0xA55A : 0x0000;
+                CHECK_EQUAL(expected, px(i, 3));
+                CHECK_EQUAL(expected, px(i, 4));
+                CHECK_EQUAL(expected, px(i, 6));
+                CHECK_EQUAL(0x0000, px(i, 2));
+                CHECK_EQUAL(0x0000, px(i, 5));
+            }
+        }
+    }
+}
+
+TEST(Canvas16, drawBitmap8_converts_to_rgb16)
+{
+    uint8_t bitmap[CW - 3];
+    for ( unsigned i = 0; i < sizeof(bitmap); i++ )
+    {
+        bitmap[i] = (i % 5 == 0) ? 0 : (uint8_t)(i * 37 + 11);
+    }
+    canvas.drawBitmap8(1, 2, sizeof(bitmap), 1, bitmap);
+    canvas.setMode(CANVAS_MODE_TRANSPARENT);
+    canvas.setColor(0x1234);
+    canvas.drawHLine(0, 5, CW - 1);
+    canvas.drawBitmap8(1, 5, sizeof(bitmap), 1, bitmap);
+    CHECK_EQUAL(0x0000, px(0, 2));
+    CHECK_EQUAL(0x0000, px(CW - 1, 2));
+    for ( unsigned i = 0; i < sizeof(bitmap); i++ )
+    {
+        uint16_t color = RGB8_TO_RGB16(bitmap[i]);
+        CHECK_EQUAL(color, px(i + 1, 2));
+        CHECK_EQUAL(bitmap[i] ? color : 0x1234, px(i + 1, 5));
+    }
+}
+
+TEST(Canvas16, drawBitmap16_transparent_keeps_black)
+{
+    uint8_t bitmap[(CW - 3) * 2];
+    for ( unsigned i = 0; i < sizeof(bitmap) / 2; i++ )
+    {
+        uint16_t color = (i % 3 == 0) ? 0 : (uint16_t)(i * 0x0811 + 1);
+        bitmap[i * 2] = color >> 8;
+        bitmap[i * 2 + 1] = color & 0xFF;
+    }
+    canvas.setColor(0x1234);
+    canvas.drawHLine(0, 7, CW - 1);
+    canvas.drawBitmap16(2, 8, sizeof(bitmap) / 2, 1, bitmap);
+    canvas.setMode(CANVAS_MODE_TRANSPARENT);
+    canvas.drawBitmap16(2, 7, sizeof(bitmap) / 2, 1, bitmap);
+    for ( unsigned i = 0; i < sizeof(bitmap) / 2; i++ )
+    {
+        uint16_t color = (bitmap[i * 2] << 8) | bitmap[i * 2 + 1];
+        CHECK_EQUAL(color, px(i + 2, 8));
+        CHECK_EQUAL(color ? color : 0x1234, px(i + 2, 7));
+    }
+    CHECK_EQUAL(0x1234, px(1, 7));
+    CHECK_EQUAL(0x0000, px(1, 8));
+}
+
+TEST(Canvas16, drawBitmap1_matches_bits)
+{
+    uint8_t bitmap[21 * 2];
+    srand(5);
+    for ( unsigned i = 0; i < sizeof(bitmap); i++ )
+    {
+        bitmap[i] = rand() & 0xFF;
+    }
+    const int pos[][2] = {{3, 4}, {-5, -3}, {20, 25}, {0, -9}};
+    for ( uint8_t mode = 0; mode < 2; mode++ )
+    {
+        for ( const auto &p : pos )
+        {
+            memset(canvas16_buf, 0x55, sizeof(canvas16_buf));
+            canvas.setMode(mode ? CANVAS_MODE_TRANSPARENT : 0);
+            canvas.setColor(0xF81F);
+            canvas.drawBitmap1(p[0], p[1], 21, 13, bitmap);
+            for ( int y = 0; y < CH; y++ )
+            {
+                for ( int x = 0; x < CW; x++ )
+                {
+                    int bx = x - p[0];
+                    int by = y - p[1];
+                    uint16_t expected = 0x5555;
+                    if ( bx >= 0 && bx < 21 && by >= 0 && by < 13 )
+                    {
+                        if ( bitmap[(by >> 3) * 21 + bx] & (1 << (by & 7)) )
+                            expected = 0xF81F;
+                        else if ( !mode )
+                            expected = 0x0000;
+                    }
+                    CHECK_EQUAL(expected, px(x, y));
+                }
+            }
+        }
+    }
+}
+
 // ============================================================
 // NanoCanvas1 tests (1-bit monochrome, page-byte layout)
 // ============================================================
@@ -0,0 +1,192 @@
+/*
+    MIT License
+
+    Copyright (c) 2026, Alexey Dynda
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <CppUTest/TestHarness.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include "lcdgfx.h"
+#include "sdl_core.h"
+
+// ==================== Command list recording (NanoCommandList) ====================
+
+// In 8-bit mode SSD1331 fills and lines are not accelerated, so all pixels are sent over the bus
+typedef DisplaySSD1331_96x64x8_CustomSPI<CountingBus<SdlSpi>> DisplayCountingSPI8;
+
+static const int SSD1331_W = 96;
+static const int SSD1331_H = 64;
+
+TEST_GROUP(COMMAND_LIST)
+{
+    DisplaySSD1331_96x64x16_SPI *display;
+    std::vector<uint16_t> *pixels;
+
+    void setup()
+    {
+        display = new DisplaySSD1331_96x64x16_SPI(-1, {-1, 0, 1, 0, -1, -1});
+        display->begin();
+        display->clear();
+        pixels = new std::vector<uint16_t>( SSD1331_W * SSD1331_H, 0 );
+    }
+
+    void teardown()
+    {
+        display->end();
+        delete pixels;
+        delete display;
+    }
+
+    void capture()
+    {
+        memset(pixels->data(), 0, pixels->size() * sizeof(uint16_t));
+        sdl_core_get_pixels_data( (uint8_t *)pixels->data(), 16 );
+    }
+
+    uint16_t px(int x, int y)
+    {
+        return (*pixels)[x + y * SSD1331_W];
+    }
+};
+
+// Recorded and optimized commands must produce the same pixels as direct drawing
+TEST(COMMAND_LIST, recorded_commands_match_direct_drawing)
+{
+    std::vector<uint16_t> expected;
+    NanoCommandListBuffer<128> big;
+    NanoCommandListBuffer<7> small;
+    NanoCommandList *lists[] = {nullptr, &big, &small};
+    for ( NanoCommandList *list : lists )
+    {
+        display->clear();
+        display->setCommandList(list);
+        srand(1);
+        for ( int i = 0; i < 60; i++ )
+        {
+            static const uint16_t colors[] = {0xF800, 0x07E0, 0x001F, 0xFFFF};
+            lcdint_t x = rand() % SSD1331_W;
+            lcdint_t y = rand() % SSD1331_H;
+            lcdint_t w = rand() % 24;
+            lcdint_t h = rand() % 12;
+            display->setColor(colors[rand() % 4]);
+            display->fillRect(x, y, x + w < SSD1331_W ? x + w : SSD1331_W - 1, y + h < SSD1331_H ? y + h : SSD1331_H - 1);
+        }
+        display->setColor(0x07E0);
+        display->drawRect(2, 2, 93, 61);
+        display->fillRect(10, 10, 20, 20);
+        display->fillRect(10, 21, 20, 30);
+        display->drawLine(0, 63, 95, 0);
+        display->setColor(0xF800);
+        display->fillCircle(48, 32, 12);
+        display->drawCircle(48, 32, 15);
+        display->setCommandList(nullptr);
+        capture();
+        if ( !list )
+        {
+            expected = *pixels;
+        }
+        else
+        {
+            CHECK_TRUE( expected == *pixels );
+        }
+    }
+}
+
+// Text and bitmaps, drawn over recorded fills, must stay on top after flush()
+TEST(COMMAND_LIST, immediate_drawing_over_recorded_fills)
+{
+    static const uint8_t bitmap[] = {0xFF, 0x81, 0x81, 0xFF};
+    std::vector<uint16_t> expected;
+    NanoCommandListBuffer<32> commands;
+    NanoCommandList *lists[] = {nullptr, &commands};
+    display->setFixedFont(ssd1306xled_font6x8);
+    for ( NanoCommandList *list : lists )
+    {
+        display->clear();
+        display->setCommandList(list);
+        display->setColor(0x001F);
+        display->fillRect(0, 0, 63, 15);
+        display->setColor(0xFFFF);
+        display->printFixed(2, 4, "LABEL");
+        display->setColor(0x001F);
+        display->fillRect(0, 20, 15, 31);
+        display->setColor(0xF800);
+        display->drawBitmap1(4, 24, 4, 8, bitmap);
+        display->flush();
+        display->setCommandList(nullptr);
+        capture();
+        if ( !list )
+        {
+            expected = *pixels;
+            int label = 0;
+            for ( int i = 0; i < SSD1331_W * 16; i++ )
+            {
+                label += (*pixels)[i] == 0xFFFF;
+            }
+            CHECK_TRUE( label > 0 );
+        }
+        else
+        {
+            CHECK_TRUE( expected == *pixels );
+        }
+    }
+}
+
+TEST_GROUP(COMMAND_LIST_BUS)
+{
+    void setup()
+    {
+        // ...
+    }
+
+    void teardown()
+    {
+        // ...
+    }
+};
+
+TEST(COMMAND_LIST_BUS, recorded_fills_are_merged_and_culled)
+{
+    DisplayCountingSPI8 display(-1, 1, 1, 1);
+    NanoCommandListBuffer<32> commands;
+    display.begin();
+    display.setCommandList(&commands);
+    display.getInterface().beginFrame();
+    display.setColor(0x00);
+    display.fillRect(0, 0, 31, 15);
+    display.setColor(0xFF);
+    for ( lcdint_t y = 0; y < 16; y++ )
+    {
+        display.drawHLine(0, y, 31);
+    }
+    display.setColor(0x1C);
+    display.fillRect(40, 0, 49, 9);
+    display.fillRect(50, 0, 59, 9);
+    CHECK_EQUAL(0, display.getInterface().getStats().bytes);
+    display.flush();
+    display.getInterface().endFrame();
+    const CountingBusStats &stats = display.getInterface().getFrameStats();
+    CHECK_EQUAL(2, stats.windows);
+    CHECK_EQUAL(32 * 16 + 20 * 10, stats.dataBytes);
+    display.end();
+}
@@ -0,0 +1,150 @@
+/*
+    MIT License
+
+    Copyright (c) 2026, Alexey Dynda
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <CppUTest/TestHarness.h>
+#include "lcdgfx.h"
+#include "sdl_core.h"
+
+typedef DisplaySSD1306_128x64_CustomI2C<CountingBus<SdlI2c>> DisplayCountingI2C;
+typedef DisplaySSD1306_128x64_CustomSPI<CountingBus<SdlSpi>> DisplayCountingSPI;
+// In 8-bit mode SSD1331 fills and lines are not accelerated, so all pixels are sent over the bus
+typedef DisplaySSD1331_96x64x8_CustomSPI<CountingBus<SdlSpi>> DisplayCountingSPI8;
+
+TEST_GROUP(COUNTING_BUS)
+{
+    void setup()
+    {
+        // ...
+    }
+
+    void teardown()
+    {
+        // ...
+    }
+};
+
+TEST(COUNTING_BUS, i2c_clear)
+{
+    DisplayCountingI2C display(-1, -1, -1, -1, 0x3C);
+    display.begin();
+    display.getInterface().beginFrame();
+    display.clear();
+    display.getInterface().endFrame();
+    const CountingBusStats &stats = display.getInterface().getFrameStats();
+    CHECK_EQUAL(128 * 64 / 8, stats.dataBytes);
+    CHECK(stats.commandBytes > 0);
+    CHECK(stats.controlBytes > 0);
+    CHECK(stats.windows > 0);
+    CHECK(stats.transactions > 0);
+    CHECK_EQUAL(stats.bytes, stats.dataBytes + stats.commandBytes + stats.controlBytes);
+    display.end();
+}
+
+TEST(COUNTING_BUS, spi_fill_rect)
+{
+    DisplayCountingSPI display(-1, 1, 1, 1);
+    display.begin();
+    display.clear();
+    display.getInterface().beginFrame();
+    display.setColor(0xFFFF);
+    display.fillRect(0, 0, 7, 7);
+    display.getInterface().endFrame();
+    const CountingBusStats &stats = display.getInterface().getFrameStats();
+    CHECK_EQUAL(8, stats.dataBytes);
+    CHECK_EQUAL(1, stats.windows);
+    CHECK_EQUAL(0, stats.controlBytes);
+    CHECK(stats.commandBytes > 0);
+    CHECK_EQUAL(stats.bytes, stats.dataBytes + stats.commandBytes);
+    display.end();
+}
+
+static void onDcWrite(void *arg, int level)
+{
+    reinterpret_cast<CountingBus<SdlSpi> *>(arg)->setDataMode(level == LCD_HIGH);
+    lcd_gpioWriteDirect(1, level);
+}
+
+TEST(COUNTING_BUS, spi_manual_dc_matches_dc_pin)
+{
+    DisplayCountingSPI8 reference(-1, 1, 1, 1);
+    reference.begin();
+    reference.getInterface().beginFrame();
+    reference.setColor(0xFF);
+    reference.fillRect(0, 0, 7, 7);
+    reference.drawLine(0, 0, 20, 10);
+    reference.getInterface().endFrame();
+    CountingBusStats expected = reference.getInterface().getFrameStats();
+    reference.end();
+
+    DisplayCountingSPI8 display(-1, 1, COUNTING_BUS_DC_MANUAL, 1);
+    lcd_registerGpioWriteHandler(1, onDcWrite, &display.getInterface());
+    display.begin();
+    display.getInterface().beginFrame();
+    display.setColor(0xFF);
+    display.fillRect(0, 0, 7, 7);
+    display.drawLine(0, 0, 20, 10);
+    display.getInterface().endFrame();
+    const CountingBusStats &stats = display.getInterface().getFrameStats();
+    CHECK_EQUAL(expected.commandBytes, stats.commandBytes);
+    CHECK_EQUAL(expected.dataBytes, stats.dataBytes);
+    CHECK_EQUAL(expected.windows, stats.windows);
+    CHECK_EQUAL(0, stats.controlBytes);
+    display.end();
+    lcd_unregisterGpioWriteHandler(1);
+}
+
+TEST(COUNTING_BUS, reset_stats)
+{
+    DisplayCountingSPI display(-1, 1, 1, 1);
+    display.begin();
+    CHECK(display.getInterface().getStats().bytes > 0);
+    display.getInterface().resetStats();
+    CHECK_EQUAL(0, display.getInterface().getStats().bytes);
+    CHECK_EQUAL(0, display.getInterface().getStats().transactions);
+    display.end();
+}
+
+TEST(COUNTING_BUS, shadow_flush_sends_dirty_spans)
+{
+    DisplayCountingSPI display(-1, 1, 1, 1);
+    NanoShadowBuffer1<128, 64> shadow;
+    display.begin();
+    display.setShadow(&shadow);
+    display.flush();
+    display.getInterface().beginFrame();
+    display.setColor(0xFFFF);
+    display.drawLine(10, 3, 20, 3);
+    display.putPixel(15, 5);
+    display.putPixel(40, 20);
+    display.flush();
+    display.getInterface().endFrame();
+    const CountingBusStats &stats = display.getInterface().getFrameStats();
+    CHECK_EQUAL(11 + 1, stats.dataBytes);
+    CHECK_EQUAL(2, stats.windows);
+    display.getInterface().beginFrame();
+    display.flush();
+    display.getInterface().endFrame();
+    CHECK_EQUAL(0, display.getInterface().getFrameStats().bytes);
+    display.end();
+}
@@ -0,0 +1,160 @@
+/*
+    MIT License
+
+    Copyright (c) 2026, Alexey Dynda
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <CppUTest/TestHarness.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include "lcdgfx.h"
+#include "sdl_core.h"
+
+// ==================== Changed canvas area (drawCanvasDirty) ====================
+
+typedef DisplaySSD1306_128x64_CustomSPI<CountingBus<SdlSpi>> DisplayCountingSPI;
+typedef DisplaySSD1331_96x64x16_CustomSPI<CountingBus<SdlSpi>> DisplayCountingSPI16;
+
+static const int SSD1331_W = 96;
+static const int SSD1331_H = 64;
+
+TEST_GROUP(DIRTY_CANVAS)
+{
+    DisplaySSD1331_96x64x16_SPI *display;
+    std::vector<uint16_t> *pixels;
+
+    void setup()
+    {
+        display = new DisplaySSD1331_96x64x16_SPI(-1, {-1, 0, 1, 0, -1, -1});
+        display->begin();
+        display->clear();
+        pixels = new std::vector<uint16_t>( SSD1331_W * SSD1331_H, 0 );
+    }
+
+    void teardown()
+    {
+        display->end();
+        delete pixels;
+        delete display;
+    }
+
+    void capture()
+    {
+        memset(pixels->data(), 0, pixels->size() * sizeof(uint16_t));
+        sdl_core_get_pixels_data( (uint8_t *)pixels->data(), 16 );
+    }
+
+    uint16_t px(int x, int y)
+    {
+        return (*pixels)[x + y * SSD1331_W];
+    }
+};
+
+TEST(DIRTY_CANVAS, matches_whole_canvas)
+{
+    NanoCanvas<40, 30, 16> canvas;
+    srand(7);
+    canvas.clear();
+    for ( int frame = 0; frame < 8; frame++ )
+    {
+        if ( frame % 3 == 2 )
+        {
+            canvas.clear();
+        }
+        for ( int i = 0; i < 3; i++ )
+        {
+            canvas.setColor(rand() & 0xFFFF);
+            int x1 = rand() % 40;
+            int y1 = rand() % 30;
+            canvas.fillRect(x1, y1, x1 + rand() % 12, y1 + rand() % 3);
+            canvas.putPixel(rand() % 40, rand() % 30);
+        }
+        display->drawCanvasDirty(7, 9, canvas);
+        capture();
+        const uint8_t *data = canvas.getData();
+        for ( int y = 0; y < 30; y++ )
+        {
+            for ( int i = 0; i < 40; i++ )
+            {
+                const uint8_t *p = &data[(y * 40 + i) * 2];
+                CHECK_EQUAL( (p[0] << 8) | p[1], px(7 + i, 9 + y) );
+            }
+        }
+    }
+}
+
+TEST_GROUP(DIRTY_CANVAS_BUS)
+{
+    void setup()
+    {
+        // ...
+    }
+
+    void teardown()
+    {
+        // ...
+    }
+};
+
+TEST(DIRTY_CANVAS_BUS, sends_changed_rect)
+{
+    DisplayCountingSPI16 display(-1, 1, 1, 1);
+    NanoCanvas<96, 64, 16> canvas;
+    display.begin();
+    canvas.clear();
+    display.getInterface().beginFrame();
+    display.drawCanvasDirty(0, 0, canvas);
+    display.getInterface().endFrame();
+    CHECK_EQUAL(96 * 64 * 2, display.getInterface().getFrameStats().dataBytes);
+    canvas.setColor(0xF800);
+    canvas.fillRect(10, 10, 19, 14);
+    display.getInterface().beginFrame();
+    display.drawCanvasDirty(0, 0, canvas);
+    display.getInterface().endFrame();
+    CountingBusStats stats = display.getInterface().getFrameStats();
+    CHECK_EQUAL(1, stats.windows);
+    CHECK_EQUAL(10 * 5 * 2, stats.dataBytes);
+    display.getInterface().beginFrame();
+    display.drawCanvasDirty(0, 0, canvas);
+    display.getInterface().endFrame();
+    CHECK_EQUAL(0, display.getInterface().getFrameStats().bytes);
+    display.end();
+}
+
+TEST(DIRTY_CANVAS_BUS, sends_changed_pages)
+{
+    DisplayCountingSPI display(-1, 1, 1, 1);
+    NanoCanvas<128, 64, 1> canvas;
+    display.begin();
+    canvas.clear();
+    display.drawCanvasDirty(0, 0, canvas);
+    canvas.setColor(0xFFFF);
+    canvas.putPixel(10, 3);
+    canvas.putPixel(20, 12);
+    display.getInterface().beginFrame();
+    display.drawCanvasDirty(0, 0, canvas);
+    display.getInterface().endFrame();
+    const CountingBusStats &stats = display.getInterface().getFrameStats();
+    CHECK_EQUAL(2, stats.windows);
+    CHECK_EQUAL(11 * 2, stats.dataBytes);
+    display.end();
+}
@@ -0,0 +1,166 @@
+/*
+    MIT License
+
+    Copyright (c) 2026, Alexey Dynda
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <CppUTest/TestHarness.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include "lcdgfx.h"
+#include "sdl_core.h"
+
+// ==================== Changed runs of full-screen canvas (NanoFrameDiff) ====================
+
+typedef DisplaySSD1306_128x64_CustomSPI<CountingBus<SdlSpi>> DisplayCountingSPI;
+// In 8-bit mode SSD1331 fills and lines are not accelerated, so all pixels are sent over the bus
+typedef DisplaySSD1331_96x64x8_CustomSPI<CountingBus<SdlSpi>> DisplayCountingSPI8;
+
+static const int SSD1331_W = 96;
+static const int SSD1331_H = 64;
+
+TEST_GROUP(FRAME_DIFF)
+{
+    DisplaySSD1331_96x64x16_SPI *display;
+    std::vector<uint16_t> *pixels;
+
+    void setup()
+    {
+        display = new DisplaySSD1331_96x64x16_SPI(-1, {-1, 0, 1, 0, -1, -1});
+        display->begin();
+        display->clear();
+        pixels = new std::vector<uint16_t>( SSD1331_W * SSD1331_H, 0 );
+    }
+
+    void teardown()
+    {
+        display->end();
+        delete pixels;
+        delete display;
+    }
+
+    void capture()
+    {
+        memset(pixels->data(), 0, pixels->size() * sizeof(uint16_t));
+        sdl_core_get_pixels_data( (uint8_t *)pixels->data(), 16 );
+    }
+
+    uint16_t px(int x, int y)
+    {
+        return (*pixels)[x + y * SSD1331_W];
+    }
+};
+
+// Changed runs of the frame, sent through NanoFrameDiff, must give the same picture as whole canvas
+TEST(FRAME_DIFF, matches_whole_canvas)
+{
+    NanoCanvas<40, 30, 16> canvas;
+    NanoFrameDiffBuffer<40, 30, 16> diff;
+    srand(5);
+    canvas.clear();
+    for ( int frame = 0; frame < 8; frame++ )
+    {
+        lcdint_t x = frame < 5 ? 7 : 50;
+        for ( int i = 0; i < 6; i++ )
+        {
+            canvas.setColor(rand() & 0xFFFF);
+            int x1 = rand() % 40;
+            int y1 = rand() % 30;
+            canvas.fillRect(x1, y1, x1 + rand() % 12, y1 + rand() % 3);
+            canvas.putPixel(rand() % 40, rand() % 30);
+        }
+        display->drawCanvas(x, 9, canvas, diff);
+        capture();
+        const uint8_t *data = canvas.getData();
+        for ( int y = 0; y < 30; y++ )
+        {
+            for ( int i = 0; i < 40; i++ )
+            {
+                // canvas keeps pixels in display byte order: high byte first
+                const uint8_t *p = &data[(y * 40 + i) * 2];
+                CHECK_EQUAL( (p[0] << 8) | p[1], px(x + i, 9 + y) );
+            }
+        }
+    }
+}
+
+TEST_GROUP(FRAME_DIFF_BUS)
+{
+    void setup()
+    {
+        // ...
+    }
+
+    void teardown()
+    {
+        // ...
+    }
+};
+
+TEST(FRAME_DIFF_BUS, sends_changed_runs)
+{
+    DisplayCountingSPI display(-1, 1, 1, 1);
+    NanoCanvas<128, 64, 1> canvas;
+    NanoFrameDiffBuffer<128, 64, 1> diff;
+    display.begin();
+    canvas.clear();
+    display.getInterface().beginFrame();
+    display.drawCanvas(0, 0, canvas, diff);
+    display.getInterface().endFrame();
+    CHECK_EQUAL(128 * 64 / 8, display.getInterface().getFrameStats().dataBytes);
+    // Near pixels are merged to single run, far ones get own windows
+    canvas.setColor(0xFFFF);
+    canvas.putPixel(10, 3);
+    canvas.putPixel(14, 4);
+    canvas.putPixel(100, 3);
+    canvas.putPixel(50, 40);
+    display.getInterface().beginFrame();
+    display.drawCanvas(0, 0, canvas, diff);
+    display.getInterface().endFrame();
+    CountingBusStats stats = display.getInterface().getFrameStats();
+    CHECK_EQUAL(5 + 1 + 1, stats.dataBytes);
+    CHECK_EQUAL(3, stats.windows);
+    display.getInterface().beginFrame();
+    display.drawCanvas(0, 0, canvas, diff);
+    display.getInterface().endFrame();
+    CHECK_EQUAL(0, display.getInterface().getFrameStats().bytes);
+    display.end();
+}
+
+TEST(FRAME_DIFF_BUS, sends_row_spans)
+{
+    DisplayCountingSPI8 display(-1, 1, 1, 1);
+    NanoCanvas<96, 64, 8> canvas;
+    NanoFrameDiffBuffer<96, 64, 8> diff;
+    display.begin();
+    canvas.clear();
+    display.drawCanvas(0, 0, canvas, diff);
+    canvas.setColor(0xE0);
+    canvas.fillRect(20, 10, 27, 25);
+    display.getInterface().beginFrame();
+    display.drawCanvas(0, 0, canvas, diff);
+    display.getInterface().endFrame();
+    const CountingBusStats &stats = display.getInterface().getFrameStats();
+    CHECK_EQUAL(16, stats.windows);
+    CHECK_EQUAL(8 * 16, stats.dataBytes);
+    display.end();
+}
@@ -0,0 +1,127 @@
+/*
+    MIT License
+
+    Copyright (c) 2026, Alexey Dynda
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <CppUTest/TestHarness.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include "lcdgfx.h"
+#include "sdl_core.h"
+
+// ==================== Glyph cache (NanoGlyphCache) ====================
+
+typedef DisplaySSD1331_96x64x16_CustomSPI<CountingBus<SdlSpi>> DisplayCountingSPI16;
+
+static const int SSD1331_W = 96;
+static const int SSD1331_H = 64;
+
+TEST_GROUP(GLYPH_CACHE)
+{
+    DisplaySSD1331_96x64x16_SPI *display;
+    std::vector<uint16_t> *pixels;
+
+    void setup()
+    {
+        display = new DisplaySSD1331_96x64x16_SPI(-1, {-1, 0, 1, 0, -1, -1});
+        display->begin();
+        display->clear();
+        pixels = new std::vector<uint16_t>( SSD1331_W * SSD1331_H, 0 );
+    }
+
+    void teardown()
+    {
+        display->end();
+        delete pixels;
+        delete display;
+    }
+
+    void capture()
+    {
+        memset(pixels->data(), 0, pixels->size() * sizeof(uint16_t));
+        sdl_core_get_pixels_data( (uint8_t *)pixels->data(), 16 );
+    }
+
+    uint16_t px(int x, int y)
+    {
+        return (*pixels)[x + y * SSD1331_W];
+    }
+};
+
+// Cached glyphs must produce the same pixels as direct expansion, also after color change
+TEST(GLYPH_CACHE, matches_direct_print)
+{
+    display->setFixedFont(ssd1306xled_font6x8);
+    display->setColor(0xF800);
+    display->printFixed(0, 0, "88A");
+    display->setColor(0x07E0);
+    display->printFixed(0, 8, "88A");
+    capture();
+    std::vector<uint16_t> expected = *pixels;
+
+    NanoGlyphCacheBuffer<2, 6 * 8 * 2> glyphs;
+    display->clear();
+    display->setGlyphCache(&glyphs);
+    display->setColor(0xF800);
+    display->printFixed(0, 0, "88A");
+    display->setColor(0x07E0);
+    display->printFixed(0, 8, "88A");
+    display->setGlyphCache(nullptr);
+    capture();
+    CHECK_TRUE( expected == *pixels );
+}
+
+TEST_GROUP(GLYPH_CACHE_BUS)
+{
+    void setup()
+    {
+        // ...
+    }
+
+    void teardown()
+    {
+        // ...
+    }
+};
+
+TEST(GLYPH_CACHE_BUS, sends_glyph_as_single_block)
+{
+    DisplayCountingSPI16 display(-1, 1, 1, 1);
+    NanoGlyphCacheBuffer<4, 24 * 32 * 2> glyphs;
+    display.begin();
+    display.setFixedFont(comic_sans_font24x32_123);
+    display.getInterface().beginFrame();
+    display.printFixed(0, 0, "12");
+    display.getInterface().endFrame();
+    CountingBusStats direct = display.getInterface().getFrameStats();
+    display.setGlyphCache(&glyphs);
+    display.printFixed(0, 0, "12");
+    display.getInterface().beginFrame();
+    display.printFixed(0, 0, "12");
+    display.getInterface().endFrame();
+    const CountingBusStats &cached = display.getInterface().getFrameStats();
+    CHECK_EQUAL(direct.dataBytes, cached.dataBytes);
+    CHECK_EQUAL(direct.windows, cached.windows);
+    CHECK(cached.calls < direct.calls);
+    display.end();
+}
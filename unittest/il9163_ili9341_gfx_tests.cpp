@@ -285,3 +285,40 @@ TEST(ILI9341_GFX, clear_after_draw)
     capture();
     CHECK_EQUAL( 0, count_nonzero() );
 }
+
+TEST(ILI9341_GFX, fillRect_full_screen)
+{
+    // 240x320 area exceeds 16-bit pixel counter
+    display->setColor(0xFFFF);
+    display->fillRect(0, 0, ILI_W - 1, ILI_H - 1);
+    capture();
+    CHECK_EQUAL( ILI_W * ILI_H, count_nonzero() );
+}
+
+TEST(ILI9341_GFX, scroll_area_moves_content_between_fixed_rows)
+{
+    for ( int y = 0; y < ILI_H; y++ )
+    {
+        display->setColor(y + 1);
+        display->drawHLine(0, y, ILI_W - 1);
+    }
+    CHECK_TRUE( display->setScrollArea(20, 299) );
+    CHECK_EQUAL( 20, display->scrollUp(16) );
+    CHECK_EQUAL( 36, display->scrollUp(100) );
+    CHECK_EQUAL( 86, display->scrollDown(50) );
+    capture();
+    for ( int y = 0; y < ILI_H; y++ )
+    {
+        uint16_t expected = display->scrolledY(y) + 1;
+        CHECK_EQUAL( expected, get_rgb16_pixel(pixels->data(), ILI_W, 5, y) );
+    }
+    CHECK_EQUAL( 85, display->scrolledY(299) );
+    // Redraw rows, exposed by the next scroll, and check they appear at the bottom of the area
+    lcdint_t y = display->scrollUp(8);
+    display->setColor(0xFFFF);
+    display->fillRect(0, y, ILI_W - 1, y + 7);
+    capture();
+    CHECK_TRUE( rgb16_region_equals(pixels->data(), ILI_W, 0, 292, ILI_W - 1, 299, 0xFFFF) );
+    CHECK_EQUAL( 301, get_rgb16_pixel(pixels->data(), ILI_W, 0, 300) );
+    CHECK_EQUAL( 20, get_rgb16_pixel(pixels->data(), ILI_W, 0, 19) );
+}
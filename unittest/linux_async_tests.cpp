@@ -0,0 +1,130 @@
+/*
+    MIT License
+
+    Copyright (c) 2019, Alexey Dynda
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+
+#include <CppUTest/TestHarness.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+#include "lcdgfx.h"
+#include "sdl_core.h"
+#include "utils/utils.h"
+#include "ssd1306_data.h"
+
+typedef DisplaySSD1306_128x64_CustomI2C<LinuxAsyncBus<SdlI2c>> DisplayAsyncSSD1306;
+typedef DisplaySSD1331_96x64x16_CustomSPI<LinuxAsyncBus<SdlSpi>> DisplayAsyncSSD1331;
+
+TEST_GROUP(LINUX_ASYNC)
+{
+    void setup()
+    {
+        // ...
+    }
+
+    void teardown()
+    {
+        // ...
+    }
+};
+
+TEST(LINUX_ASYNC, monochrome_test)
+{
+    DisplayAsyncSSD1306 display(-1, -1, -1, -1, 0x3C);
+    display.begin();
+    display.getInterface().setAsync(true);
+    CHECK_TRUE( display.getInterface().isAsync() );
+    display.clear();
+    display.setFixedFont(ssd1306xled_font6x8);
+    display.printFixed (0,  8, "Line 1. Normal text", STYLE_NORMAL);
+    display.printFixed (0, 16, "Line 2. Bold text", STYLE_BOLD);
+    display.printFixed (0, 24, "Line 3. Italic text", STYLE_ITALIC);
+    display.printFixedN (0, 32, "Line 4. Double size", STYLE_BOLD, FONT_SIZE_2X);
+    display.getInterface().waitIdle();
+
+    std::vector<uint8_t> pixels( sdl_core_get_pixels_len( 1 ), 0 );
+    sdl_core_get_pixels_data( pixels.data(), 1 );
+    CHECK_EQUAL( sizeof(monochrome_test_data), pixels.size() );
+    MEMCMP_EQUAL( monochrome_test_data, pixels.data(), sizeof(monochrome_test_data));
+
+    display.end();
+}
+
+TEST(LINUX_ASYNC, canvas_is_copied_to_queue)
+{
+    DisplayAsyncSSD1306 display(-1, -1, -1, -1, 0x3C);
+    NanoCanvas<128, 64, 1> canvas;
+    display.begin();
+    display.getInterface().setAsync(true);
+    canvas.setColor(1);
+    canvas.fillRect(0, 0, 63, 63);
+    display.drawCanvas(0, 0, canvas);
+    // Drawing to the canvas must not affect the frame in the queue
+    canvas.clear();
+    display.getInterface().waitIdle();
+
+    std::vector<uint8_t> pixels( sdl_core_get_pixels_len( 1 ), 0 );
+    sdl_core_get_pixels_data( pixels.data(), 1 );
+    CHECK_EQUAL( 0xFF, pixels[0] );
+    CHECK_EQUAL( 0xFF, pixels[63] );
+    CHECK_EQUAL( 0x00, pixels[64] );
+
+    LinuxAsyncStats stats = display.getInterface().getStats();
+    CHECK_EQUAL( 0, stats.depth );
+    CHECK_TRUE( stats.slots > 0 );
+    CHECK_TRUE( stats.maxDepth > 0 );
+    display.end();
+}
+
+TEST(LINUX_ASYNC, dc_pin_changes_are_queued)
+{
+    DisplayAsyncSSD1331 display(-1, 1, 1, 1);
+    std::vector<uint8_t> expected( sdl_core_get_pixels_len( 16 ), 0 );
+    std::vector<uint8_t> pixels( expected.size(), 0 );
+    display.begin();
+    display.setFixedFont(ssd1306xled_font6x8);
+    for ( int async = 0; async < 2; async++ )
+    {
+        display.getInterface().setAsync(async != 0);
+        display.getInterface().resetStats();
+        display.clear();
+        display.setColor(RGB_COLOR16(255, 0, 0));
+        display.fillRect(4, 4, 60, 40);
+        display.setColor(RGB_COLOR16(0, 255, 0));
+        display.drawLine(0, 63, 95, 0);
+        display.printFixed(8, 48, "D/C", STYLE_NORMAL);
+        if ( async )
+        {
+            // Drawing thread never waits for the queue to drain on D/C pin changes
+            LinuxAsyncStats stats = display.getInterface().getStats();
+            CHECK_EQUAL( 0, stats.stalls );
+            CHECK_EQUAL( 0, stats.waitUs );
+            CHECK_TRUE( stats.slots > 0 );
+            display.getInterface().waitIdle();
+        }
+        sdl_core_get_pixels_data( async ? pixels.data() : expected.data(), 16 );
+    }
+    CHECK_TRUE( expected == pixels );
+    display.end();
+}
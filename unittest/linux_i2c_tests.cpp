@@ -0,0 +1,201 @@
+/*
+    MIT License
+
+    Copyright (c) 2026, Alexey Dynda
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <CppUTest/TestHarness.h>
+#include <vector>
+#include "lcdgfx.h"
+
+typedef struct
+{
+    std::vector<uint8_t> bytes;
+    const uint8_t *data;
+    uint16_t flags;
+    int request;
+} SentMessage;
+
+static std::vector<SentMessage> s_sent;
+static int s_requests = 0;
+
+static void onFlush(void *arg, const LinuxI2cMessages::I2cSegment *segments, uint8_t count)
+{
+    for ( uint8_t i = 0; i < count; i++ )
+    {
+        SentMessage msg;
+        msg.bytes.assign(segments[i].data, segments[i].data + segments[i].size);
+        msg.data = segments[i].data;
+        msg.flags = segments[i].flags;
+        msg.request = s_requests;
+        s_sent.push_back(msg);
+    }
+    s_requests++;
+}
+
+TEST_GROUP(LINUX_I2C)
+{
+    LinuxI2cMessages *messages;
+
+    void setup()
+    {
+        s_sent.clear();
+        s_requests = 0;
+        messages = new LinuxI2cMessages(onFlush, nullptr);
+    }
+
+    void teardown()
+    {
+        delete messages;
+    }
+};
+
+TEST(LINUX_I2C, restart_sends_commands_and_data_in_one_request)
+{
+    const uint8_t data[4] = {1, 2, 3, 4};
+    messages->start();
+    messages->send(0x00);
+    messages->send(0x21);
+    messages->send(0x00);
+    messages->restart();
+    CHECK_EQUAL(0, s_requests);
+    messages->send(0x40);
+    messages->sendBuffer(data, sizeof(data));
+    messages->stop();
+    CHECK_EQUAL(1, s_requests);
+    CHECK_EQUAL(2, s_sent.size());
+    CHECK_EQUAL(3, s_sent[0].bytes.size());
+    CHECK_EQUAL(0x00, s_sent[0].bytes[0]);
+    CHECK_EQUAL(0, s_sent[0].flags);
+    CHECK_EQUAL(5, s_sent[1].bytes.size());
+    CHECK_EQUAL(0x40, s_sent[1].bytes[0]);
+    CHECK_EQUAL(0, s_sent[1].flags);
+    MEMCMP_EQUAL(data, &s_sent[1].bytes[1], sizeof(data));
+}
+
+TEST(LINUX_I2C, long_transaction_is_split_with_control_byte)
+{
+    uint8_t data[40];
+    for ( int i = 0; i < 40; i++ )
+    {
+        data[i] = i + 1;
+    }
+    messages->setMaxMessageSize(16);
+    messages->start();
+    messages->send(0x40);
+    messages->sendBuffer(data, sizeof(data));
+    messages->stop();
+    // 40 bytes of payload go in messages of 15 + 15 + 10 bytes, each prefixed with 0x40
+    CHECK_EQUAL(3, s_sent.size());
+    std::vector<uint8_t> payload;
+    for ( size_t i = 0; i < s_sent.size(); i++ )
+    {
+        CHECK(s_sent[i].bytes.size() <= 16);
+        CHECK_EQUAL(0x40, s_sent[i].bytes[0]);
+        CHECK_EQUAL(0, s_sent[i].flags);
+        CHECK_EQUAL(0, s_sent[i].request);
+        payload.insert(payload.end(), s_sent[i].bytes.begin() + 1, s_sent[i].bytes.end());
+    }
+    CHECK_EQUAL(sizeof(data), payload.size());
+    MEMCMP_EQUAL(data, payload.data(), sizeof(data));
+}
+
+TEST(LINUX_I2C, split_keeps_transaction_control_byte)
+{
+    messages->setMaxMessageSize(4);
+    messages->start();
+    messages->send(0x00);
+    messages->sendRepeat(0xA5, 5);
+    messages->restart();
+    messages->send(0x40);
+    messages->sendRepeat16(0x1234, 2);
+    messages->stop();
+    CHECK_EQUAL(4, s_sent.size());
+    const uint8_t cmd1[] = {0x00, 0xA5, 0xA5, 0xA5};
+    const uint8_t cmd2[] = {0x00, 0xA5, 0xA5};
+    const uint8_t data1[] = {0x40, 0x12, 0x34};
+    const uint8_t data2[] = {0x40, 0x12, 0x34};
+    CHECK_EQUAL(sizeof(cmd1), s_sent[0].bytes.size());
+    MEMCMP_EQUAL(cmd1, s_sent[0].bytes.data(), sizeof(cmd1));
+    CHECK_EQUAL(sizeof(cmd2), s_sent[1].bytes.size());
+    MEMCMP_EQUAL(cmd2, s_sent[1].bytes.data(), sizeof(cmd2));
+    CHECK_EQUAL(sizeof(data1), s_sent[2].bytes.size());
+    MEMCMP_EQUAL(data1, s_sent[2].bytes.data(), sizeof(data1));
+    CHECK_EQUAL(sizeof(data2), s_sent[3].bytes.size());
+    MEMCMP_EQUAL(data2, s_sent[3].bytes.data(), sizeof(data2));
+}
+
+TEST(LINUX_I2C, nostart_sends_large_buffer_without_copy)
+{
+    uint8_t data[100];
+    memset(data, 0x5A, sizeof(data));
+    messages->setNoStart(true);
+    messages->start();
+    messages->send(0x40);
+    messages->sendBuffer(data, sizeof(data));
+    // user buffer is sent before sendBuffer() returns
+    CHECK_EQUAL(1, s_requests);
+    messages->send(0x77);
+    messages->stop();
+    CHECK_EQUAL(2, s_requests);
+    CHECK_EQUAL(3, s_sent.size());
+    CHECK_EQUAL(1, s_sent[0].bytes.size());
+    CHECK_EQUAL(0x40, s_sent[0].bytes[0]);
+    CHECK_EQUAL(0, s_sent[0].flags);
+    CHECK_EQUAL(sizeof(data), s_sent[1].bytes.size());
+    CHECK_EQUAL(LinuxI2cMessages::FLAG_NOSTART, s_sent[1].flags);
+    POINTERS_EQUAL(data, s_sent[1].data);
+    // rest of transaction goes in new message with the same control byte
+    CHECK_EQUAL(2, s_sent[2].bytes.size());
+    CHECK_EQUAL(0x40, s_sent[2].bytes[0]);
+    CHECK_EQUAL(0x77, s_sent[2].bytes[1]);
+    CHECK_EQUAL(0, s_sent[2].flags);
+}
+
+TEST(LINUX_I2C, nostart_splits_by_max_message_size)
+{
+    uint8_t data[100];
+    memset(data, 0x5A, sizeof(data));
+    messages->setNoStart(true);
+    messages->setMaxMessageSize(64);
+    messages->start();
+    messages->send(0x40);
+    messages->sendBuffer(data, sizeof(data));
+    messages->stop();
+    // [0x40][63 bytes in place] [0x40][37 bytes in place]
+    CHECK_EQUAL(4, s_sent.size());
+    CHECK_EQUAL(0x40, s_sent[0].bytes[0]);
+    CHECK_EQUAL(63, s_sent[1].bytes.size());
+    CHECK_EQUAL(LinuxI2cMessages::FLAG_NOSTART, s_sent[1].flags);
+    CHECK_EQUAL(1, s_sent[2].bytes.size());
+    CHECK_EQUAL(0x40, s_sent[2].bytes[0]);
+    CHECK_EQUAL(0, s_sent[2].flags);
+    CHECK_EQUAL(37, s_sent[3].bytes.size());
+    POINTERS_EQUAL(data + 63, s_sent[3].data);
+}
+
+TEST(LINUX_I2C, max_message_size_is_clamped)
+{
+    messages->setMaxMessageSize(2);
+    CHECK_EQUAL(4, messages->getMaxMessageSize());
+    messages->setMaxMessageSize(10000);
+    CHECK_EQUAL(8192, messages->getMaxMessageSize());
+}
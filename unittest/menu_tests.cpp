@@ -352,3 +352,22 @@ TEST(CheckboxMenuTests, MaxItems16)
     CHECK_TRUE(menu.isChecked(15));
     CHECK_EQUAL(0x8000, menu.checkedMask());
 }
+
+TEST(MenuTests, InvalidateRemeasuresChangedItems)
+{
+    const char *items[3] = { "Item 1", "Item 2 with long label", "Item 3" };
+    LcdGfxMenu menu(items, 3);
+    menu.show(*display);
+    items[1] = "I";
+    menu.invalidate();
+    menu.show(*display);
+    uint8_t rgb[3];
+    for ( int x = 20; x < 100; x++ )
+    {
+        for ( int y = 16; y < 24; y++ )
+        {
+            sdl_core_get_pixel_rgb(x, y, rgb);
+            CHECK_EQUAL(0, rgb[0] | rgb[1] | rgb[2]);
+        }
+    }
+}
@@ -0,0 +1,100 @@
+/*
+    MIT License
+
+    Copyright (c) 2026, Alexey Dynda
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <CppUTest/TestHarness.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include "lcdgfx.h"
+#include "sdl_core.h"
+
+// ==================== 1-bit buffer expansion to native colors ====================
+
+static const int SSD1331_W = 96;
+static const int SSD1331_H = 64;
+
+TEST_GROUP(MONO_EXPANSION)
+{
+    DisplaySSD1331_96x64x16_SPI *display;
+    std::vector<uint16_t> *pixels;
+
+    void setup()
+    {
+        display = new DisplaySSD1331_96x64x16_SPI(-1, {-1, 0, 1, 0, -1, -1});
+        display->begin();
+        display->clear();
+        pixels = new std::vector<uint16_t>( SSD1331_W * SSD1331_H, 0 );
+    }
+
+    void teardown()
+    {
+        display->end();
+        delete pixels;
+        delete display;
+    }
+
+    void capture()
+    {
+        memset(pixels->data(), 0, pixels->size() * sizeof(uint16_t));
+        sdl_core_get_pixels_data( (uint8_t *)pixels->data(), 16 );
+    }
+
+    uint16_t px(int x, int y)
+    {
+        return (*pixels)[x + y * SSD1331_W];
+    }
+};
+
+// Page-oriented mono buffers must expand to foreground / background pixels bit by bit
+TEST(MONO_EXPANSION, buffer_expansion_matches_bits)
+{
+    static uint8_t bits[24 * 2];
+    srand(3);
+    for ( unsigned i = 0; i < sizeof(bits); i++ )
+    {
+        bits[i] = rand() & 0xFF;
+    }
+    NanoCanvasOps<1> mono;
+    mono.begin(24, 16, bits);
+    display->setColor(0xF81F);
+    display->setBackground(0x0841);
+    display->drawBuffer1(3, 5, 21, 13, bits);
+    display->drawBitmap1(40, 2, 21, 13, bits);
+    display->drawCanvas(60, 40, mono);
+    capture();
+    const int areas[][4] = {{3, 5, 21, 13}, {40, 2, 21, 13}, {60, 40, 24, 16}};
+    for ( const auto &a : areas )
+    {
+        for ( int y = 0; y < a[3]; y++ )
+        {
+            for ( int x = 0; x < a[2]; x++ )
+            {
+                bool set = bits[(y >> 3) * a[2] + x] & (1 << (y & 7));
+                CHECK_EQUAL( set ? 0xF81F : 0x0841, px(a[0] + x, a[1] + y) );
+            }
+        }
+    }
+    CHECK_EQUAL( 0, px(2, 5) );
+    CHECK_EQUAL( 0, px(24, 17) );
+}
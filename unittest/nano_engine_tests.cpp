@@ -0,0 +1,230 @@
+/*
+    MIT License
+
+    Copyright (c) 2026, Alexey Dynda
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <CppUTest/TestHarness.h>
+#include "lcdgfx.h"
+#include "nano_engine_v2.h"
+#include "sdl_core.h"
+
+typedef NanoEngine<TILE_8x8_RGB16, DisplayILI9341_240x320x16_SPI> WideEngine;
+
+static WideEngine *s_engine = nullptr;
+static int s_tiles = 0;
+static NanoPoint s_lastTile;
+
+static bool countTiles()
+{
+    s_tiles++;
+    s_lastTile = s_engine->getCanvas().offset;
+    return true;
+}
+
+class CountingObject: public NanoObject<WideEngine::TilerT>
+{
+public:
+    using NanoObject<WideEngine::TilerT>::NanoObject;
+
+    void draw() override
+    {
+        draws++;
+    }
+
+    int draws = 0;
+};
+
+TEST_GROUP(NANO_ENGINE_TILER)
+{
+    DisplayILI9341_240x320x16_SPI *display;
+
+    void setup()
+    {
+        display = new DisplayILI9341_240x320x16_SPI(-1, {-1, 0, 1, 0, -1, -1});
+        display->begin();
+        s_engine = new WideEngine(*display);
+        s_engine->drawCallback(countTiles);
+        s_engine->display();
+        s_tiles = 0;
+    }
+
+    void teardown()
+    {
+        delete s_engine;
+        s_engine = nullptr;
+        display->end();
+        delete display;
+    }
+};
+
+TEST(NANO_ENGINE_TILER, full_refresh_covers_wide_display)
+{
+    s_engine->refresh();
+    s_engine->display();
+    CHECK_EQUAL((240 / 8) * (320 / 8), s_tiles);
+    CHECK_EQUAL(232, s_lastTile.x);
+    CHECK_EQUAL(312, s_lastTile.y);
+}
+
+TEST(NANO_ENGINE_TILER, refresh_last_tile)
+{
+    s_engine->refresh(233, 313, 239, 319);
+    s_engine->display();
+    CHECK_EQUAL(1, s_tiles);
+    CHECK_EQUAL(232, s_lastTile.x);
+    CHECK_EQUAL(312, s_lastTile.y);
+}
+
+TEST(NANO_ENGINE_TILER, refresh_rect_beyond_16_columns)
+{
+    s_engine->refresh(17 * 8, 25 * 8, 20 * 8 + 1, 26 * 8 + 7);
+    s_engine->display();
+    CHECK_EQUAL(8, s_tiles);
+    CHECK_EQUAL(20 * 8, s_lastTile.x);
+    CHECK_EQUAL(26 * 8, s_lastTile.y);
+    s_tiles = 0;
+    s_engine->display();
+    CHECK_EQUAL(0, s_tiles);
+}
+
+TEST(NANO_ENGINE_TILER, refresh_outside_display_is_clipped)
+{
+    s_engine->refresh(NanoPoint{1000, 1000});
+    s_engine->refresh(-10, -10, -1, -1);
+    s_engine->refresh(230, 310, 1000, 1000);
+    s_engine->display();
+    CHECK_EQUAL(4, s_tiles);
+}
+
+TEST(NANO_ENGINE_TILER, dirty_map_spans)
+{
+    typedef NanoEngineDirtyMap<2, 20> DirtyMap;
+    DirtyMap map;
+    uint8_t row[DirtyMap::ROW_BYTES];
+    CHECK_FALSE(map.takeRow(0, row));
+    map.set(1, 0);
+    map.setRect(6, 0, 17, 0);
+    map.set(19, 0);
+    CHECK_TRUE(map.takeRow(0, row));
+    CHECK_FALSE(map.takeRow(0, row));
+    uint16_t column = 0;
+    uint16_t count = 0;
+    map.set(1, 1);
+    map.setRect(6, 1, 17, 1);
+    map.set(19, 1);
+    map.takeRow(1, row);
+    CHECK_TRUE(DirtyMap::nextSpan(row, column, count));
+    CHECK_EQUAL(1, column);
+    CHECK_EQUAL(1, count);
+    column += count;
+    CHECK_TRUE(DirtyMap::nextSpan(row, column, count));
+    CHECK_EQUAL(6, column);
+    CHECK_EQUAL(12, count);
+    column += count;
+    CHECK_TRUE(DirtyMap::nextSpan(row, column, count));
+    CHECK_EQUAL(19, column);
+    CHECK_EQUAL(1, count);
+    column += count;
+    CHECK_FALSE(DirtyMap::nextSpan(row, column, count));
+}
+
+TEST(NANO_ENGINE_TILER, objects_are_drawn_only_for_overlapping_tiles)
+{
+    CountingObject small({0, 0}, {8, 8});
+    CountingObject big({100, 200}, {16, 16});
+    s_engine->insert(small);
+    s_engine->insert(big);
+    s_engine->refresh();
+    s_engine->display();
+    CHECK_EQUAL(1, small.draws);
+    CHECK_EQUAL(3 * 2, big.draws);
+
+    big.moveTo({0, 300});
+    s_engine->display();
+    CHECK_EQUAL(1, small.draws);
+    CHECK_EQUAL(3 * 2 + 2 * 3, big.draws);
+    s_engine->remove(big);
+    s_engine->remove(small);
+}
+
+TEST(NANO_ENGINE_TILER, objects_in_list_are_culled)
+{
+    NanoObjectList<WideEngine::TilerT> list({0, 0});
+    CountingObject item({8, 8}, {8, 8});
+    list.add(item);
+    s_engine->insert(list);
+    s_engine->refresh();
+    s_engine->display();
+    CHECK_EQUAL(1, item.draws);
+    s_engine->remove(list);
+}
+
+static bool drawRedSquare()
+{
+    NanoCanvasOps<16> &canvas = s_engine->getCanvas();
+    s_tiles++;
+    canvas.clear();
+    canvas.setColor(RGB_COLOR16(255, 0, 0));
+    canvas.fillRect(50, 50, 60, 60);
+    return true;
+}
+
+TEST(NANO_ENGINE_TILER, strip_merges_adjacent_tiles)
+{
+    static uint8_t strip[240 * 8 * 2];
+    CountingObject object({100, 200}, {16, 16});
+    s_engine->insert(object);
+    s_engine->setStripBuffer(strip, 240);
+    s_engine->refresh();
+    s_engine->display();
+    CHECK_EQUAL(320 / 8, s_tiles);
+    CHECK_EQUAL(2, object.draws);
+    CHECK_EQUAL(8, s_engine->getCanvas().width());
+
+    s_tiles = 0;
+    s_engine->refresh(8, 8, 8 * 5, 8);
+    s_engine->refresh(8 * 10, 8, 8 * 10, 8);
+    s_engine->display();
+    CHECK_EQUAL(2, s_tiles);
+    s_engine->remove(object);
+    s_engine->setStripBuffer(nullptr, 0);
+}
+
+TEST(NANO_ENGINE_TILER, strip_output_matches_tiles)
+{
+    static uint8_t strip[64 * 8 * 2];
+    uint8_t rgb[3];
+    s_engine->drawCallback(drawRedSquare);
+    s_engine->setStripBuffer(strip, 64);
+    s_engine->refresh();
+    s_engine->display();
+    CHECK_EQUAL((320 / 8) * 4, s_tiles);
+    sdl_core_get_pixel_rgb(55, 55, rgb);
+    CHECK(rgb[0] > 200 && rgb[1] < 50 && rgb[2] < 50);
+    sdl_core_get_pixel_rgb(50, 60, rgb);
+    CHECK(rgb[0] > 200 && rgb[1] < 50 && rgb[2] < 50);
+    sdl_core_get_pixel_rgb(61, 55, rgb);
+    CHECK_EQUAL(0, rgb[0] | rgb[1] | rgb[2]);
+    sdl_core_get_pixel_rgb(55, 49, rgb);
+    CHECK_EQUAL(0, rgb[0] | rgb[1] | rgb[2]);
+    s_engine->setStripBuffer(nullptr, 0);
+}
@@ -0,0 +1,63 @@
+/*
+    MIT License
+
+    Copyright (c) 2026, Alexey Dynda
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <CppUTest/TestHarness.h>
+#include "lcdgfx.h"
+#include "sdl_core.h"
+
+// ==================== Single page burst for 1-bit frames ====================
+
+typedef DisplaySSD1306_128x64_CustomI2C<CountingBus<SdlI2c>> DisplayCountingI2C;
+
+TEST_GROUP(PAGE_BURST)
+{
+    void setup()
+    {
+        // ...
+    }
+
+    void teardown()
+    {
+        // ...
+    }
+};
+
+TEST(PAGE_BURST, i2c_canvas_single_burst)
+{
+    DisplayCountingI2C display(-1, -1, -1, -1, 0x3C);
+    NanoCanvas<128, 64, 1> canvas;
+    display.begin();
+    canvas.clear();
+    display.getInterface().beginFrame();
+    display.drawCanvas(0, 0, canvas);
+    display.getInterface().endFrame();
+    const CountingBusStats &stats = display.getInterface().getFrameStats();
+    CHECK_EQUAL(128 * 64 / 8, stats.dataBytes);
+    // Addressing commands are sent once, all pages go in one data transaction
+    CHECK_EQUAL(1, stats.windows);
+    CHECK_EQUAL(2, stats.transactions);
+    // 2 control bytes, 6 addressing command bytes and single sendBuffer() for all 8 pages
+    CHECK_EQUAL(2 + 6 + 1, stats.calls);
+    display.end();
+}
@@ -0,0 +1,64 @@
+/*
+    MIT License
+
+    Copyright (c) 2026, Alexey Dynda
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <CppUTest/TestHarness.h>
+#include "lcdgfx.h"
+#include "sdl_core.h"
+
+// ==================== Hardware vertical scrolling ====================
+
+typedef DisplaySSD1306_128x64_CustomSPI<CountingBus<SdlSpi>> DisplayCountingSPI;
+typedef DisplaySSD1331_96x64x16_CustomSPI<CountingBus<SdlSpi>> DisplayCountingSPI16;
+
+TEST_GROUP(SCROLL)
+{
+    void setup()
+    {
+        // ...
+    }
+
+    void teardown()
+    {
+        // ...
+    }
+};
+
+TEST(SCROLL, scroll_sends_no_pixels)
+{
+    DisplayCountingSPI display(-1, 1, 1, 1);
+    display.begin();
+    display.getInterface().beginFrame();
+    CHECK_EQUAL(0, display.scrollUp(8));
+    display.getInterface().endFrame();
+    const CountingBusStats &stats = display.getInterface().getFrameStats();
+    CHECK_EQUAL(0, stats.dataBytes);
+    // start line command to set default area, and then to scroll it
+    CHECK_EQUAL(2, stats.commandBytes);
+    display.end();
+    // SSD1331 has no start line register, so caller redraws the screen
+    DisplayCountingSPI16 color(-1, 1, 1, 1);
+    color.begin();
+    CHECK_EQUAL(-1, color.scrollUp(8));
+    color.end();
+}
@@ -24,7 +24,9 @@
 
 #include <CppUTest/TestHarness.h>
 #include <stdlib.h>
+#include <stdio.h>
 #include <string.h>
+#include "lcdgfx.h"
 #include "sdl_core.h"
 
 // ==================== SDL core utility function tests ====================
@@ -101,3 +103,100 @@ TEST(SDL_CORE_GPIO, sdl_dc_mode)
     sdl_set_dc_pin(128);
     CHECK_EQUAL(0, sdl_is_dc_mode());
 }
+
+// ==================== Emulator framebuffer access tests ====================
+
+TEST_GROUP(SDL_CORE_FRAMEBUFFER)
+{
+    DisplaySSD1306_128x64_I2C *display;
+
+    void setup()
+    {
+        display = new DisplaySSD1306_128x64_I2C(-1);
+        display->begin();
+        display->clear();
+    }
+
+    void teardown()
+    {
+        display->end();
+        delete display;
+    }
+};
+
+TEST(SDL_CORE_FRAMEBUFFER, get_framebuffer_and_pixel)
+{
+    int width = 0, height = 0, bpp = 0;
+    const void *fb = sdl_core_get_framebuffer(&width, &height, &bpp);
+    CHECK(fb != nullptr);
+    CHECK_EQUAL(128, width);
+    CHECK_EQUAL(64, height);
+    CHECK(bpp == 8 || bpp == 16 || bpp == 32);
+
+    uint8_t rgb[3];
+    sdl_core_get_pixel_rgb(10, 20, rgb);
+    CHECK_EQUAL(0, rgb[0] | rgb[1] | rgb[2]);
+    display->setColor(0xFFFF);
+    display->putPixel(10, 20);
+    sdl_core_get_pixel_rgb(10, 20, rgb);
+    CHECK(rgb[0] | rgb[1] | rgb[2]);
+}
+
+TEST(SDL_CORE_FRAMEBUFFER, frame_count_grows_on_capture)
+{
+    sdl_core_capture_frame();
+    uint32_t frames = sdl_core_get_frame_count();
+    display->setColor(0xFFFF);
+    display->fillRect(0, 0, 15, 7);
+    display->fillRect(0, 8, 15, 15);
+    // Frames are counted only at explicit frame boundary
+    CHECK_EQUAL(frames, sdl_core_get_frame_count());
+    sdl_core_capture_frame();
+    CHECK_EQUAL(frames + 1, sdl_core_get_frame_count());
+    sdl_core_capture_frame();
+    CHECK_EQUAL(frames + 1, sdl_core_get_frame_count());
+}
+
+TEST(SDL_CORE_FRAMEBUFFER, frame_stream_matches_pixels)
+{
+    const char *name = "/tmp/lcdgfx_sdl_core_test.rgb";
+    CHECK_EQUAL(0, sdl_core_set_frame_stream(name));
+    display->setColor(0xFFFF);
+    display->fillRect(0, 0, 7, 7);
+    sdl_core_capture_frame();
+    sdl_core_set_frame_stream(nullptr);
+    FILE *f = fopen(name, "rb");
+    CHECK(f != nullptr);
+    static uint8_t frame[128 * 64 * 3];
+    CHECK_EQUAL(sizeof(frame), fread(frame, 1, sizeof(frame), f));
+    CHECK_EQUAL(EOF, fgetc(f));
+    fclose(f);
+    remove(name);
+    for ( int y = 0; y < 64; y += 3 )
+    {
+        for ( int x = 0; x < 128; x += 5 )
+        {
+            uint8_t rgb[3];
+            sdl_core_get_pixel_rgb(x, y, rgb);
+            MEMCMP_EQUAL(rgb, &frame[(x + y * 128) * 3], 3);
+        }
+    }
+    CHECK(frame[0] | frame[1] | frame[2]);
+}
+
+TEST(SDL_CORE_FRAMEBUFFER, save_ppm)
+{
+    const char *name = "/tmp/lcdgfx_sdl_core_test.ppm";
+    display->setColor(0xFFFF);
+    display->fillRect(0, 0, 7, 7);
+    CHECK_EQUAL(0, sdl_core_save_ppm(name));
+    FILE *f = fopen(name, "rb");
+    CHECK(f != nullptr);
+    char header[16] = {0};
+    CHECK(fgets(header, sizeof(header), f) != nullptr);
+    STRCMP_EQUAL("P6\n", header);
+    fseek(f, 0, SEEK_END);
+    CHECK(ftell(f) > 128 * 64 * 3);
+    fclose(f);
+    remove(name);
+}
@@ -211,6 +211,26 @@ TEST(PCD8544_GFX, fill_sets_all_pixels)
     CHECK_TRUE( mono_region_equals(pixels->data(), PCD_W, 0, 0, PCD_W - 1, PCD_H - 1, 1) );
 }
 
+TEST(PCD8544_GFX, drawCanvas_full_screen_burst)
+{
+    NanoCanvas<PCD_W, PCD_H, 1> canvas;
+    canvas.clear();
+    canvas.setColor(0xFFFF);
+    canvas.fillRect(3, 2, 20, 11);
+    canvas.drawLine(0, 47, 83, 0);
+    canvas.putPixel(83, 47);
+    display->drawCanvas(0, 0, canvas);
+    capture();
+    for ( int y = 0; y < PCD_H; y++ )
+    {
+        for ( int x = 0; x < PCD_W; x++ )
+        {
+            int bit = (canvas.getData()[(y >> 3) * PCD_W + x] >> (y & 7)) & 1;
+            CHECK_EQUAL( bit, px(x, y) );
+        }
+    }
+}
+
 TEST(PCD8544_GFX, drawHLine)
 {
     display->setColor(0xFFFF);
@@ -0,0 +1,145 @@
+/*
+    MIT License
+
+    Copyright (c) 2026, Alexey Dynda
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <CppUTest/TestHarness.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include "lcdgfx.h"
+#include "sdl_core.h"
+
+// ==================== Lines and circles, sent as runs ====================
+
+// In 8-bit mode SSD1331 fills and lines are not accelerated, so all pixels are sent over the bus
+typedef DisplaySSD1331_96x64x8_CustomSPI<CountingBus<SdlSpi>> DisplayCountingSPI8;
+
+static const int SSD1331_W = 96;
+static const int SSD1331_H = 64;
+
+TEST_GROUP(SHAPE_RUNS)
+{
+    DisplaySSD1331_96x64x16_SPI *display;
+    std::vector<uint16_t> *pixels;
+
+    void setup()
+    {
+        display = new DisplaySSD1331_96x64x16_SPI(-1, {-1, 0, 1, 0, -1, -1});
+        display->begin();
+        display->clear();
+        pixels = new std::vector<uint16_t>( SSD1331_W * SSD1331_H, 0 );
+    }
+
+    void teardown()
+    {
+        display->end();
+        delete pixels;
+        delete display;
+    }
+
+    void capture()
+    {
+        memset(pixels->data(), 0, pixels->size() * sizeof(uint16_t));
+        sdl_core_get_pixels_data( (uint8_t *)pixels->data(), 16 );
+    }
+
+    uint16_t px(int x, int y)
+    {
+        return (*pixels)[x + y * SSD1331_W];
+    }
+};
+
+// Lines and circles, sent as runs, must match pixel by pixel drawing of the canvas
+TEST(SHAPE_RUNS, line_and_circle_runs_match_canvas)
+{
+    static uint8_t buf[SSD1331_W * SSD1331_H * 2];
+    NanoCanvasOps<16> canvas;
+    canvas.begin(SSD1331_W, SSD1331_H, buf);
+    const lcdint_t lines[][4] = {{0, 0, 95, 63}, {95, 0, 0, 63}, {10, 60, 90, 5}, {3, 2, 20, 60},
+                                 {50, 63, 45, 0}, {0, 30, 95, 31}, {7, 7, 7, 7}, {20, 10, 60, 10}};
+    for ( uint8_t options = 1; options <= 15; options++ )
+    {
+        memset(buf, 0, sizeof(buf));
+        canvas.setColor(0xFFFF);
+        display->clear();
+        display->setColor(0xFFFF);
+        for ( const auto &l : lines )
+        {
+            canvas.drawLine(l[0], l[1], l[2], l[3]);
+            display->drawLine(l[0], l[1], l[2], l[3]);
+        }
+        for ( lcdint_t r = 0; r < 32; r += 3 )
+        {
+            canvas.drawCircle(48, 32, r, options);
+            display->drawCircle(48, 32, r, options);
+        }
+        capture();
+        for ( int y = 0; y < SSD1331_H; y++ )
+        {
+            for ( int x = 0; x < SSD1331_W; x++ )
+            {
+                uint16_t expected = (buf[(x + y * SSD1331_W) * 2] << 8) | buf[(x + y * SSD1331_W) * 2 + 1];
+                CHECK_EQUAL( expected, px(x, y) );
+            }
+        }
+    }
+}
+
+TEST_GROUP(SHAPE_RUNS_BUS)
+{
+    void setup()
+    {
+        // ...
+    }
+
+    void teardown()
+    {
+        // ...
+    }
+};
+
+TEST(SHAPE_RUNS_BUS, fillCircle_sends_window_per_row)
+{
+    DisplayCountingSPI8 display(-1, 1, 1, 1);
+    display.begin();
+    display.getInterface().beginFrame();
+    display.setColor(0xFF);
+    display.fillCircle(48, 32, 10);
+    display.getInterface().endFrame();
+    CHECK_EQUAL(21, display.getInterface().getFrameStats().windows);
+    display.end();
+}
+
+TEST(SHAPE_RUNS_BUS, drawLine_sends_runs)
+{
+    DisplayCountingSPI8 display(-1, 1, 1, 1);
+    display.begin();
+    display.getInterface().beginFrame();
+    display.setColor(0xFF);
+    display.drawLine(0, 0, 95, 15);
+    display.getInterface().endFrame();
+    const CountingBusStats &stats = display.getInterface().getFrameStats();
+    CHECK_EQUAL(96, stats.dataBytes);
+    CHECK_EQUAL(16, stats.windows);
+    display.end();
+}
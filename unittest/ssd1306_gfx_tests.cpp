@@ -213,6 +213,75 @@ TEST(SSD1306_GFX, clearRect_preserves_current_color)
 // writes a single bit but replaces the entire page byte (no GDRAM read-modify-write).
 // These operations are tested on the 8-bit SSD1331 where pixels are independent.
 
+TEST(SSD1306_GFX, shadow_draws_nothing_until_flush)
+{
+    NanoShadowBuffer1<W, H> shadow;
+    display->setShadow(&shadow);
+    display->flush();
+    display->setColor(0xFFFF);
+    display->fillRect(20, 16, 60, 48);
+    capture();
+    CHECK_EQUAL(0, px(40, 30));
+    display->flush();
+    capture();
+    CHECK_TRUE( mono_region_equals(pixels->data(), W, 20, 16, 60, 48, 1) );
+    display->setShadow(nullptr);
+}
+
+TEST(SSD1306_GFX, shadow_putPixel_keeps_neighbours)
+{
+    NanoShadowBuffer1<W, H> shadow;
+    display->setShadow(&shadow);
+    display->setColor(0xFFFF);
+    display->drawLine(0, 0, 63, 63);
+    display->drawCircle(90, 30, 20);
+    display->flush();
+    display->setShadow(nullptr);
+    capture();
+    for ( int i = 0; i < 64; i++ )
+        CHECK_EQUAL(1, px(i, i));
+    CHECK_EQUAL(1, px(110, 30));
+    CHECK_EQUAL(1, px(90, 10));
+    CHECK_EQUAL(1, px(90, 50));
+    CHECK_EQUAL(0, px(90, 30));
+    CHECK_EQUAL(0, px(1, 0));
+}
+
+TEST(SSD1306_GFX, shadow_clearRect_is_pixel_exact)
+{
+    NanoShadowBuffer1<W, H> shadow;
+    display->setShadow(&shadow);
+    display->fill(0xFF);
+    display->clearRect(20, 18, 60, 37);
+    display->flush();
+    display->setShadow(nullptr);
+    capture();
+    CHECK_TRUE( mono_region_equals(pixels->data(), W, 20, 18, 60, 37, 0) );
+    CHECK_EQUAL(1, px(40, 17));
+    CHECK_EQUAL(1, px(40, 38));
+    CHECK_EQUAL(1, px(19, 30));
+    CHECK_EQUAL(1, px(61, 30));
+}
+
+TEST(SSD1306_GFX, drawTextRun_matches_printFixed)
+{
+    display->setFixedFont(ssd1306xled_font6x8);
+    const char *text = "AB";
+    SGlyphRecord glyphs[2];
+    uint16_t count = display->getFont().decodeTextRun(text, glyphs, 2);
+    CHECK_EQUAL(12, display->drawTextRun(0, 8, glyphs, count));
+    display->printFixed(0, 24, "AB");
+    capture();
+    int lit = 0;
+    for ( int y = 0; y < 8; y++ )
+        for ( int x = 0; x < 12; x++ )
+        {
+            CHECK_EQUAL(px(x, 24 + y), px(x, 8 + y));
+            lit += px(x, 8 + y);
+        }
+    CHECK(lit > 0);
+}
+
 TEST(SSD1306_GFX, setColor_getColor_roundtrip)
 {
     display->setColor(0x0000);
@@ -234,3 +303,23 @@ TEST(SSD1306_GFX, composite_fill_then_clear)
     CHECK_EQUAL(1, px(15, 15));
     CHECK_TRUE( mono_region_equals(pixels->data(), W, 20, 20, 40, 40, 0) );
 }
+
+TEST(SSD1306_GFX, scrollUp_moves_content_and_exposes_bottom_rows)
+{
+    display->setColor(0xFFFF);
+    display->fillRect(0, 8, 15, 15);
+    display->fillRect(0, 16, 31, 23);
+    CHECK_EQUAL(0, display->scrollUp(8));
+    capture();
+    CHECK_EQUAL(16 * 8, mono_count_set(pixels->data(), W, 0, 0, W - 1, 7));
+    CHECK_EQUAL(32 * 8, mono_count_set(pixels->data(), W, 0, 8, W - 1, 15));
+    CHECK_EQUAL(16, display->scrolledY(8));
+    display->fillRect(0, 0, 7, 7);
+    capture();
+    CHECK_EQUAL(8 * 8, mono_count_set(pixels->data(), W, 0, H - 8, W - 1, H - 1));
+    CHECK_EQUAL(0, display->scrollDown(8));
+    capture();
+    CHECK_EQUAL(8 * 8, mono_count_set(pixels->data(), W, 0, 0, W - 1, 7));
+    CHECK_EQUAL(16 * 8, mono_count_set(pixels->data(), W, 0, 8, W - 1, 15));
+    CHECK_FALSE(display->setScrollArea(8, H - 1));
+}
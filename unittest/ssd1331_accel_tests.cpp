@@ -0,0 +1,170 @@
+/*
+    MIT License
+
+    Copyright (c) 2026, Alexey Dynda
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <CppUTest/TestHarness.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include "lcdgfx.h"
+#include "sdl_core.h"
+
+// ==================== SSD1331 fills, lines and clear via hardware commands ====================
+
+typedef DisplaySSD1331_96x64x16_CustomSPI<CountingBus<SdlSpi>> DisplayCountingSPI16;
+
+static const int SSD1331_W = 96;
+static const int SSD1331_H = 64;
+
+TEST_GROUP(SSD1331_ACCEL)
+{
+    DisplaySSD1331_96x64x16_SPI *display;
+    std::vector<uint16_t> *pixels;
+
+    void setup()
+    {
+        display = new DisplaySSD1331_96x64x16_SPI(-1, {-1, 0, 1, 0, -1, -1});
+        display->begin();
+        display->clear();
+        pixels = new std::vector<uint16_t>( SSD1331_W * SSD1331_H, 0 );
+    }
+
+    void teardown()
+    {
+        display->end();
+        delete pixels;
+        delete display;
+    }
+
+    void capture()
+    {
+        memset(pixels->data(), 0, pixels->size() * sizeof(uint16_t));
+        sdl_core_get_pixels_data( (uint8_t *)pixels->data(), 16 );
+    }
+
+    uint16_t px(int x, int y)
+    {
+        return (*pixels)[x + y * SSD1331_W];
+    }
+};
+
+// Hardware fills and lines must match pixels, streamed from canvas, in all rotations
+TEST(SSD1331_ACCEL, hardware_commands_match_canvas)
+{
+    static uint8_t buf[SSD1331_W * SSD1331_H * 2];
+    for ( uint8_t rotation = 0; rotation < 4; rotation++ )
+    {
+        display->getInterface().setRotation(rotation);
+        lcduint_t w = display->width();
+        lcduint_t h = display->height();
+        NanoCanvasOps<16> canvas;
+        canvas.begin(w, h, buf);
+        canvas.clear();
+        display->setColor(0xFFFF);
+        display->fillRect(0, 0, w - 1, h - 1);
+        display->clear();
+        const uint16_t colors[] = {0xF800, 0x07E0, 0x001F, 0xFFE0};
+        for ( uint8_t i = 0; i < 4; i++ )
+        {
+            canvas.setColor(colors[i]);
+            display->setColor(colors[i]);
+            canvas.fillRect(3 + i * 9, 2 + i * 5, 20 + i * 11, 12 + i * 7);
+            display->fillRect(3 + i * 9, 2 + i * 5, 20 + i * 11, 12 + i * 7);
+            canvas.drawLine(i, h - 1, w - 1 - i * 7, i * 3);
+            display->drawLine(i, h - 1, w - 1 - i * 7, i * 3);
+            canvas.drawHLine(1, 30 + i, w - 2);
+            display->drawHLine(1, 30 + i, w - 2);
+            canvas.putPixel(5 + i, 6);
+            display->putPixel(5 + i, 6);
+        }
+        capture();
+        std::vector<uint16_t> accelerated = *pixels;
+        display->drawBuffer16(0, 0, w, h, buf);
+        capture();
+        CHECK_TRUE( accelerated == *pixels );
+    }
+    display->getInterface().setRotation(0);
+}
+
+TEST_GROUP(SSD1331_ACCEL_BUS)
+{
+    void setup()
+    {
+        // ...
+    }
+
+    void teardown()
+    {
+        // ...
+    }
+};
+
+TEST(SSD1331_ACCEL_BUS, draws_with_hardware_commands)
+{
+    DisplayCountingSPI16 display(-1, 1, 1, 1);
+    display.begin();
+    display.getInterface().beginFrame();
+    display.clear();
+    display.setColor(0xF800);
+    display.fillRect(10, 10, 50, 40);
+    display.drawLine(0, 0, 95, 63);
+    display.getInterface().endFrame();
+    const CountingBusStats &stats = display.getInterface().getFrameStats();
+    CHECK_EQUAL(0, stats.dataBytes);
+    // clear window: 5 bytes, filled rectangle: 13 bytes, line: 8 bytes
+    CHECK_EQUAL(5 + 13 + 8, stats.commandBytes);
+    display.end();
+}
+
+// Rectangle, filled by the controller in rotations 90 and 270, must cover the same pixels as streamed one
+TEST(SSD1331_ACCEL_BUS, rotated_fillRect_matches_streamed_pixels)
+{
+    static uint16_t accelerated[96 * 64];
+    static uint16_t streamed[96 * 64];
+    static uint8_t rect[10 * 31 * 2];
+    for ( unsigned i = 0; i < sizeof(rect); i += 2 )
+    {
+        rect[i] = 0xF8;
+        rect[i + 1] = 0x00;
+    }
+    DisplayCountingSPI16 display(-1, 1, 1, 1);
+    display.begin();
+    for ( uint8_t rotation = 1; rotation < 4; rotation += 2 )
+    {
+        display.getInterface().setRotation(rotation);
+        CHECK_EQUAL(64, display.width());
+        display.clear();
+        display.getInterface().beginFrame();
+        display.setColor(0xF800);
+        display.fillRect(3, 50, 12, 80);
+        display.getInterface().endFrame();
+        CHECK_EQUAL(0, display.getInterface().getFrameStats().dataBytes);
+        sdl_core_get_pixels_data((uint8_t *)accelerated, 16);
+        display.clear();
+        display.drawBuffer16(3, 50, 10, 31, rect);
+        sdl_core_get_pixels_data((uint8_t *)streamed, 16);
+        MEMCMP_EQUAL(streamed, accelerated, sizeof(streamed));
+    }
+    display.getInterface().setRotation(0);
+    display.end();
+}
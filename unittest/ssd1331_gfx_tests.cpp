@@ -202,3 +202,21 @@ TEST(SSD1331_GFX, overlapping_colors)
     CHECK_EQUAL(0x1C, px(60, 45));  // green-only region
     CHECK_EQUAL(0x1C, px(40, 30));  // overlap = green (last draw wins)
 }
+
+TEST(SSD1331_GFX, glyph_cache_matches_direct_print)
+{
+    display->setFixedFont(ssd1306xled_font6x8);
+    display->setColor(0xE0);
+    display->printFixed(0, 0, "Hello");
+    capture();
+    std::vector<uint8_t> expected = *pixels;
+
+    NanoGlyphCacheBuffer<4, 6 * 8> glyphs;
+    display->clear();
+    display->setGlyphCache(&glyphs);
+    display->printFixed(0, 0, "Hello");
+    display->printFixed(0, 0, "Hello");
+    display->setGlyphCache(nullptr);
+    capture();
+    CHECK_TRUE( expected == *pixels );
+}
@@ -200,3 +200,37 @@ TEST(SSD1351_GFX, color_preserved)
     CHECK_TRUE( green_px != 0 );
     CHECK_TRUE( red_px != green_px );
 }
+
+TEST(SSD1351_GFX, drawTextRun_matches_write)
+{
+    NanoGlyphCacheBuffer<4, 16 * 16 * 2> glyphs;
+    for ( int cached = 0; cached < 2; cached++ )
+    {
+        display->clear();
+        display->setGlyphCache(cached ? &glyphs : nullptr);
+        display->setFreeFont(free_calibri11x12);
+        display->getFont().setSpacing(2);
+        display->setColor(0xFFFF);
+        display->fillRect(0, 0, W - 1, 63);
+        display->setColor(0xF800);
+        display->setBackground(0x001F);
+        const char *text = "Tag, jy";
+        const char *p = text;
+        SGlyphRecord run[8];
+        uint16_t count = display->getFont().decodeTextRun(p, run, 8);
+        display->setTextCursor(0, 32);
+        lcdint_t end = display->drawTextRun(0, 8, run, count);
+        CHECK_EQUAL(display->getFont().getTextSize(text), end);
+        display->write(text);
+        capture();
+        int background = 0;
+        for ( int y = 0; y < 12; y++ )
+            for ( int x = 0; x < end; x++ )
+            {
+                CHECK_EQUAL(px(x, 32 + y), px(x, 8 + y));
+                background += px(x, 8 + y) == 0x001F;
+            }
+        CHECK(background > 0);
+        display->setGlyphCache(nullptr);
+    }
+}
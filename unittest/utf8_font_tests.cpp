@@ -235,3 +235,116 @@ TEST(CyrillicFontTests, GetTextSizeWalksUtf8MultiByteSequence)
     CHECK_EQUAL(12, width);
     CHECK_EQUAL(8, height);
 }
+
+TEST(CyrillicFontTests, FreeFontResolvesBothTables)
+{
+    NanoFont font;
+    font.loadFreeFont(free_calibri11x12);
+    font.loadSecondaryFont(free_calibri11x12_cyrillic);
+    SCharInfo info;
+    font.getCharBitmap(0x0410, &info); // А
+    CHECK_EQUAL(6, info.width);
+    CHECK_EQUAL(9, info.height);
+    font.getCharBitmap(0x0411, &info); // Б
+    CHECK_EQUAL(5, info.width);
+    font.getCharBitmap('A', &info);
+    CHECK(info.width > 0);
+    font.getCharBitmap(0x0500, &info);
+    CHECK_EQUAL(0, info.width);
+}
+
+TEST(CyrillicFontTests, RepeatedLookupsReturnSameGlyph)
+{
+    NanoFont font;
+    font.loadFreeFont(free_calibri11x12);
+    font.loadSecondaryFont(free_calibri11x12_cyrillic);
+    SCharInfo first[64];
+    for ( uint16_t i = 0; i < 64; i++ )
+    {
+        font.getCharBitmap(0x0410 + i, &first[i]);
+    }
+    for ( uint16_t i = 0; i < 64; i++ )
+    {
+        SCharInfo again;
+        font.getCharBitmap(0x0410 + i, &again);
+        POINTERS_EQUAL(first[i].glyph, again.glyph);
+        CHECK_EQUAL(first[i].width, again.width);
+    }
+}
+
+TEST(CyrillicFontTests, SpacingChangeIsNotHiddenByCache)
+{
+    NanoFont font;
+    font.loadFreeFont(free_calibri11x12);
+    SCharInfo info;
+    font.getCharBitmap('A', &info);
+    CHECK_EQUAL(1, info.spacing);
+    font.setSpacing(3);
+    font.getCharBitmap('A', &info);
+    CHECK_EQUAL(3, info.spacing);
+}
+
+TEST(CyrillicFontTests, TextRunMeasuresLikeGetTextSize)
+{
+    NanoFont font;
+    font.loadFixedFont(ssd1306xled_font6x8);
+    font.loadSecondaryFont(ssd1306xled_font6x8_Cyrillic);
+    const char *text = "A\xD0\x90\xD0\x91 b";
+    SGlyphRecord glyphs[8];
+    uint16_t count = font.decodeTextRun(text, glyphs, 8);
+    CHECK_EQUAL(5, count);
+    CHECK_EQUAL(0, *text);
+    CHECK_EQUAL(0x0410, glyphs[1].unicode);
+    CHECK_EQUAL(font.getTextSize("A\xD0\x90\xD0\x91 b"), NanoFont::getTextRunWidth(glyphs, count));
+}
+
+TEST(CyrillicFontTests, TextRunDecodesInChunks)
+{
+    NanoFont font;
+    font.loadFixedFont(ssd1306xled_font6x8);
+    const char *text = "abc\r\nde";
+    SGlyphRecord glyphs[2];
+    CHECK_EQUAL(2, font.decodeTextRun(text, glyphs, 2));
+    CHECK_EQUAL(2, font.decodeTextRun(text, glyphs, 2));
+    CHECK_EQUAL('c', glyphs[0].unicode);
+    CHECK_EQUAL('\n', glyphs[1].unicode);
+    CHECK_EQUAL(0, glyphs[1].info.width);
+    CHECK_EQUAL(2, font.decodeTextRun(text, glyphs, 2));
+    CHECK_EQUAL(0, font.decodeTextRun(text, glyphs, 2));
+}
+
+TEST(CyrillicFontTests, TextRunWrapsAtSpaces)
+{
+    NanoFont font;
+    font.loadFixedFont(ssd1306xled_font6x8);
+    const char *text = "ab cd efgh\nij";
+    SGlyphRecord glyphs[16];
+    uint16_t count = font.decodeTextRun(text, glyphs, 16);
+    uint16_t lineCount;
+    // 6 pixels per glyph: "ab cd" fits 30 pixels, "efgh" fits 24
+    uint16_t next = NanoFont::wrapTextRun(glyphs, count, 0, 32, lineCount);
+    CHECK_EQUAL(5, lineCount);
+    CHECK_EQUAL(6, next);
+    next = NanoFont::wrapTextRun(glyphs, count, next, 32, lineCount);
+    CHECK_EQUAL(4, lineCount);
+    CHECK_EQUAL('i', glyphs[next].unicode);
+    // Word longer than the line is broken at glyph boundary
+    next = NanoFont::wrapTextRun(glyphs, count, 6, 12, lineCount);
+    CHECK_EQUAL(2, lineCount);
+    CHECK_EQUAL(8, next);
+    next = NanoFont::wrapTextRun(glyphs, count, 11, 0, lineCount);
+    CHECK_EQUAL(2, lineCount);
+    CHECK_EQUAL(count, next);
+}
+
+TEST(CyrillicFontTests, RevisionChangesOnFontUpdate)
+{
+    NanoFont font;
+    font.loadFixedFont(ssd1306xled_font6x8);
+    uint8_t revision = font.getRevision();
+    font.setSpacing(2);
+    CHECK(revision != font.getRevision());
+    revision = font.getRevision();
+    font.loadFixedFont(ssd1306xled_font5x7);
+    CHECK(revision != font.getRevision());
+}